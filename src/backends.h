@@ -0,0 +1,132 @@
+#pragma once
+
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <concepts>
+#include <utility>
+#include <vector>
+
+#include "components.h"
+
+// Thin adapters so a scenario can be written once as a template and instantiated per ECS.
+// Every adapter owns its world and maps the handful of operations the workloads need:
+//  create()          - new entity without components
+//  add<T>(e, value)  - attach (or overwrite) T
+//  remove<T>(e)      - detach T
+//  destroy(ids)      - destroy a batch of entities
+//  view<Ts...>()     - object with each(fn), fn taking Ts&...; build it once, call each() per frame
+// Views must not outlive the adapter.
+namespace backend {
+    template <typename B>
+    concept Backend = requires(B& b, typename B::Entity e, std::vector<typename B::Entity>& ids) {
+        { B::name } -> std::convertible_to<const char*>;
+        { b.create() } -> std::same_as<typename B::Entity>;
+        b.template add<Position>(e, Position{});
+        b.template remove<Position>(e);
+        b.destroy(ids);
+        b.template view<Position, Velocity>().each([](Position&, Velocity&) {});
+    };
+
+    template <bool ThreadSafe>
+    class Ecss {
+    public:
+        using Entity = ecss::EntityId;
+        static constexpr const char* name = ThreadSafe ? "ecss_ts" : "ecss";
+
+        Entity create() { return mReg.takeEntity(); }
+
+        template <typename T>
+        void add(Entity e, const T& value) { mReg.template addComponent<T>(e, value); }
+
+        template <typename T>
+        void remove(Entity e) { mReg.template destroyComponent<T>(e); }
+
+        void destroy(std::vector<Entity>& ids) { mReg.destroyEntities(ids); }
+
+        template <typename... Ts>
+        auto view() { return mReg.template view<Ts...>(); }
+
+    private:
+        ecss::Registry<ThreadSafe> mReg;
+    };
+
+    class Entt {
+    public:
+        using Entity = entt::entity;
+        static constexpr const char* name = "entt";
+
+        Entity create() { return mReg.create(); }
+
+        template <typename T>
+        void add(Entity e, const T& value) { mReg.emplace_or_replace<T>(e, value); }
+
+        template <typename T>
+        void remove(Entity e) { mReg.remove<T>(e); }
+
+        void destroy(std::vector<Entity>& ids) { mReg.destroy(ids.begin(), ids.end()); }
+
+        template <typename... Ts>
+        auto view() { return mReg.view<Ts...>(); }
+
+    private:
+        entt::registry mReg;
+    };
+
+    // flecs queries outlive their handle until destructed; the view owns its query
+    template <typename... Ts>
+    class FlecsView {
+    public:
+        explicit FlecsView(flecs::query<Ts...> query) : mQuery(query) {}
+        FlecsView(FlecsView&& other) noexcept : mQuery(std::exchange(other.mQuery, flecs::query<Ts...>())) {}
+        FlecsView(const FlecsView&) = delete;
+        FlecsView& operator=(const FlecsView&) = delete;
+        FlecsView& operator=(FlecsView&&) = delete;
+
+        ~FlecsView() {
+            if (mQuery) {
+                mQuery.destruct();
+            }
+        }
+
+        template <typename Fn>
+        void each(Fn&& fn) { mQuery.each(std::forward<Fn>(fn)); }
+
+    private:
+        flecs::query<Ts...> mQuery;
+    };
+
+    class Flecs {
+    public:
+        using Entity = flecs::entity;
+        static constexpr const char* name = "flecs";
+
+        Entity create() { return mWorld.entity(); }
+
+        template <typename T>
+        void add(Entity e, const T& value) { e.set<T>(value); }
+
+        template <typename T>
+        void remove(Entity e) { e.remove<T>(); }
+
+        void destroy(std::vector<Entity>& ids) {
+            mWorld.defer_begin();
+            for (auto e : ids) {
+                e.destruct();
+            }
+            mWorld.defer_end();
+        }
+
+        template <typename... Ts>
+        FlecsView<Ts...> view() { return FlecsView<Ts...>(mWorld.query<Ts...>()); }
+
+    private:
+        flecs::world mWorld;
+    };
+
+    static_assert(Backend<Ecss<false>>);
+    static_assert(Backend<Ecss<true>>);
+    static_assert(Backend<Entt>);
+    static_assert(Backend<Flecs>);
+}
@@ -6,9 +6,15 @@
 #include <vector>
 #include <unordered_map>
 #include <cstdint>
+#include <algorithm>
+#include <memory>
+#include <thread>
 
-struct Position { float x, y, z; };
-struct Velocity { float vx, vy, vz; };
+#include "components.h"
+#include "memory_tracking.h"
+#include "registration.h"
+#include "perf_counters.h"
+#include "cache_tiers.h"
 
 // Combined entity for vector baseline (AoS layout)
 struct Entity {
@@ -145,6 +151,7 @@ namespace vec {
         for (int i = 0; i < state.range(0); ++i) {
             positions.push_back(Position{(float)i, (float)i + 1.f, (float)i + 2.f});
         }
+        PERF_ENTITY_COUNTERS(state, state.range(0));
         for (auto _ : state) {
             float sum = 0.f;
             for (const auto& p : positions) {
@@ -164,6 +171,7 @@ namespace vec {
             positions.push_back(Position{(float)i, (float)i * 2.f, (float)i * 3.f});
             velocities.push_back(Velocity{(float)i * 0.5f, (float)i * 0.25f, (float)i * 0.125f});
         }
+        PERF_ENTITY_COUNTERS(state, state.range(0));
         for (auto _ : state) {
             float accum = 0.f;
             for (size_t i = 0; i < positions.size(); ++i) {
@@ -185,6 +193,7 @@ namespace vec {
             velocities[i] = Velocity{(float)i * 0.5f, (float)i * 0.25f, (float)i * 0.125f};
             entityToIdx[i] = i;
         }
+        PERF_ENTITY_COUNTERS(state, state.range(0));
         for (auto _ : state) {
             float accum = 0.f;
             // Iterate with indirection (like ECS separate storage lookup)
@@ -213,6 +222,7 @@ namespace vec {
             velocityMap[i] = Velocity{(float)i * 0.5f, (float)i * 0.25f, (float)i * 0.125f};
         }
         
+        PERF_ENTITY_COUNTERS(state, n / step);
         for (auto _ : state) {
             float accum = 0.f;
             // Iterate velocity (smaller set) and lookup position
@@ -346,6 +356,7 @@ namespace ecss
             reg.addComponent<Position>(e, Position{ (float)i, (float)i + 1.f, (float)i + 2.f });
         }
         auto view = reg.view<Position>();
+        PERF_ENTITY_COUNTERS(state, state.range(0));
         for (auto _ : state) {
             float sum = 0.f;
             view.each([&](Position& p) {
@@ -366,6 +377,7 @@ namespace ecss
             reg.addComponent<Velocity>(e, Velocity{ (float)i * 0.5f, (float)i * 0.25f, (float)i * 0.125f });
         }
         auto view = reg.view<Position, Velocity>();
+        PERF_ENTITY_COUNTERS(state, state.range(0));
         for (auto _ : state) {
             float accum = 0.f;
             view.each([&](Position& p, Velocity& v) {
@@ -385,6 +397,7 @@ namespace ecss
             reg.addComponent<Velocity>(e, Velocity{ (float)i * 0.5f, (float)i * 0.25f, (float)i * 0.125f });
         }
         auto view = reg.view<Position, Velocity>();
+        PERF_ENTITY_COUNTERS(state, state.range(0));
         for (auto _ : state) {
             float accum = 0.f;
             view.each([&](Position& p, Velocity& v) {
@@ -415,6 +428,7 @@ namespace ecss
         
         // Velocity first = iterate smaller set (n/50), lookup Position
         auto view = reg.view<Velocity, Position>();
+        PERF_ENTITY_COUNTERS(state, n / step);
         for (auto _ : state) {
             float accum = 0.f;
             view.each([&](Velocity& v, Position& p) {
@@ -548,6 +562,7 @@ namespace ecss_ts
             reg.addComponent<Position>(e, Position{ (float)i, (float)i + 1.f, (float)i + 2.f });
         }
         auto view = reg.view<Position>();
+        PERF_ENTITY_COUNTERS(state, state.range(0));
         for (auto _ : state) {
             float sum = 0.f;
             view.each([&](Position& p) {
@@ -568,6 +583,7 @@ namespace ecss_ts
             reg.addComponent<Velocity>(e, Velocity{ (float)i * 0.5f, (float)i * 0.25f, (float)i * 0.125f });
         }
         auto view = reg.view<Position, Velocity>();
+        PERF_ENTITY_COUNTERS(state, state.range(0));
         for (auto _ : state) {
             float accum = 0.f;
             view.each([&](Position& p, Velocity& v) {
@@ -587,6 +603,7 @@ namespace ecss_ts
             reg.addComponent<Velocity>(e, Velocity{ (float)i * 0.5f, (float)i * 0.25f, (float)i * 0.125f });
         }
         auto view = reg.view<Position, Velocity>();
+        PERF_ENTITY_COUNTERS(state, state.range(0));
         for (auto _ : state) {
             float accum = 0.f;
             view.each([&](Position& p, Velocity& v) {
@@ -615,6 +632,7 @@ namespace ecss_ts
         
         // Velocity first = iterate smaller set (n/50), lookup Position
         auto view = reg.view<Velocity, Position>();
+        PERF_ENTITY_COUNTERS(state, n / step);
         for (auto _ : state) {
             float accum = 0.f;
             view.each([&](Velocity& v, Position& p) {
@@ -625,6 +643,142 @@ namespace ecss_ts
     }
 }
 
+// ================= Thread-safe ecss contention benchmarks =====================
+// Same Position/Velocity workloads as ecss_ts, but every thread works on ONE shared
+// Registry<true>. Thread 0 builds the registry before the timing loop and tears it down
+// after it; google-benchmark holds the other threads at the start/stop barriers meanwhile.
+// items_per_second is summed over threads, so it reads as total ops/sec per thread count.
+namespace ecss_ts_mt
+{
+    using Reg = ecss::Registry<true>;
+    using ecss::EntityId;
+
+    static std::unique_ptr<Reg> sharedReg;
+    static std::vector<EntityId> sharedIds;
+
+    // Upper bound for ThreadRange: 1, 2, 4, ... up to the core count
+    static int maxThreads() {
+        return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    // Every thread spawns a batch of Position + Velocity entities and destroys it again
+    static void contended_take_add_destroy(benchmark::State& state) {
+        const int batch = state.range(0);
+        if (state.thread_index() == 0) {
+            sharedReg = std::make_unique<Reg>();
+            sharedReg->registerArray<Position, Velocity>();
+        }
+        std::vector<EntityId> ids;
+        ids.reserve(batch);
+        for (auto _ : state) {
+            ids.clear();
+            for (int i = 0; i < batch; ++i) {
+                auto e = sharedReg->takeEntity();
+                sharedReg->addComponent<Position>(e, Position{ 7.f, 8.f, 9.f });
+                sharedReg->addComponent<Velocity>(e, Velocity{ 1.f, 2.f, 3.f });
+                ids.push_back(e);
+            }
+            sharedReg->destroyEntities(ids);
+        }
+        state.SetItemsProcessed(state.iterations() * batch * 3);
+        if (state.thread_index() == 0) {
+            sharedReg.reset();
+        }
+    }
+
+    // Every thread adds/removes Velocity on its own slice of pre-created Position entities
+    static void contended_add_component(benchmark::State& state) {
+        const int batch = state.range(0);
+        if (state.thread_index() == 0) {
+            sharedReg = std::make_unique<Reg>();
+            sharedIds.clear();
+            sharedIds.reserve(static_cast<size_t>(batch) * state.threads());
+            for (int i = 0; i < batch * state.threads(); ++i) {
+                auto e = sharedReg->takeEntity();
+                sharedReg->addComponent<Position>(e, Position{ (float)i, (float)i + 1.f, (float)i + 2.f });
+                sharedIds.push_back(e);
+            }
+        }
+        for (auto _ : state) {
+            const size_t first = static_cast<size_t>(batch) * state.thread_index();
+            for (size_t i = first; i < first + batch; ++i) {
+                sharedReg->addComponent<Velocity>(sharedIds[i], Velocity{ 1.f, 2.f, 3.f });
+            }
+            for (size_t i = first; i < first + batch; ++i) {
+                sharedReg->destroyComponent<Velocity>(sharedIds[i]);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * batch * 2);
+        if (state.thread_index() == 0) {
+            sharedReg.reset();
+            sharedIds.clear();
+        }
+    }
+
+    // Every thread iterates the same Position view (readers only)
+    static void contended_view_each(benchmark::State& state) {
+        const int n = state.range(0);
+        if (state.thread_index() == 0) {
+            sharedReg = std::make_unique<Reg>();
+            for (int i = 0; i < n; ++i) {
+                auto e = sharedReg->takeEntity();
+                sharedReg->addComponent<Position>(e, Position{ (float)i, (float)i + 1.f, (float)i + 2.f });
+            }
+        }
+        for (auto _ : state) {
+            float sum = 0.f;
+            sharedReg->view<Position>().each([&](Position& p) {
+                sum += p.x + p.y + p.z;
+            });
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+        if (state.thread_index() == 0) {
+            sharedReg.reset();
+        }
+    }
+
+    // Odd threads iterate Position while even threads spawn/destroy batches in the same registry
+    static void contended_read_write(benchmark::State& state) {
+        const int n = state.range(0);
+        const int batch = n / 100;
+        if (state.thread_index() == 0) {
+            sharedReg = std::make_unique<Reg>();
+            sharedReg->registerArray<Position, Velocity>();
+            for (int i = 0; i < n; ++i) {
+                auto e = sharedReg->takeEntity();
+                sharedReg->addComponent<Position>(e, Position{ (float)i, (float)i + 1.f, (float)i + 2.f });
+                sharedReg->addComponent<Velocity>(e, Velocity{ 1.f, 2.f, 3.f });
+            }
+        }
+        const bool writer = state.thread_index() % 2 == 0;
+        std::vector<EntityId> ids;
+        ids.reserve(batch);
+        for (auto _ : state) {
+            if (writer) {
+                ids.clear();
+                for (int i = 0; i < batch; ++i) {
+                    auto e = sharedReg->takeEntity();
+                    sharedReg->addComponent<Position>(e, Position{ 7.f, 8.f, 9.f });
+                    sharedReg->addComponent<Velocity>(e, Velocity{ 1.f, 2.f, 3.f });
+                    ids.push_back(e);
+                }
+                sharedReg->destroyEntities(ids);
+            } else {
+                float accum = 0.f;
+                sharedReg->view<Position, Velocity>().each([&](Position& p, Velocity& v) {
+                    accum += p.x + p.y + p.z + v.vx + v.vy + v.vz;
+                });
+                benchmark::DoNotOptimize(accum);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * (writer ? batch * 3 : n));
+        if (state.thread_index() == 0) {
+            sharedReg.reset();
+        }
+    }
+}
+
 namespace entt
 {
     using big_registry = entt::registry;
@@ -727,6 +881,7 @@ namespace entt
             reg.emplace<Position>(e, Position{ (float)i, (float)i + 1.f, (float)i + 2.f });
         }
         auto view = reg.view<Position>();
+        PERF_ENTITY_COUNTERS(state, state.range(0));
         for (auto _ : state) {
             float sum = 0.f;
             view.each([&](Position& p) {
@@ -745,6 +900,7 @@ namespace entt
             reg.emplace<Velocity>(e, Velocity{ (float)i * 0.5f, (float)i * 0.25f, (float)i * 0.125f });
         }
         auto view = reg.view<Position, Velocity>();
+        PERF_ENTITY_COUNTERS(state, state.range(0));
         for (auto _ : state) {
             float accum = 0.f;
             view.each([&](Position& pos, Velocity& vel) {
@@ -780,6 +936,7 @@ namespace entt
         }
         
         auto view = reg.view<Position, Velocity>();
+        PERF_ENTITY_COUNTERS(state, n / step);
         for (auto _ : state) {
             float accum = 0.f;
             view.each([&](Position& pos, Velocity& vel) {
@@ -888,6 +1045,7 @@ namespace flecs {
             world.entity().set<Position>({(float)i, (float)i + 1.f, (float)i + 2.f});
         }
         flecs::query<Position> q = world.query<Position>();
+        PERF_ENTITY_COUNTERS(state, state.range(0));
         for (auto _ : state) {
             float sum = 0.f;
             q.each([&](Position &p){ sum += p.x + p.y + p.z; });
@@ -904,6 +1062,7 @@ namespace flecs {
                              .set<Velocity>({(float)i * 0.5f, (float)i * 0.25f, (float)i * 0.125f});
         }
         flecs::query<Position, Velocity> q = world.query<Position, Velocity>();
+        PERF_ENTITY_COUNTERS(state, state.range(0));
         for (auto _ : state) {
             float accum = 0.f;
             q.each([&](Position &p, Velocity &v){ accum += p.x + p.y + p.z + v.vx + v.vy + v.vz; });
@@ -935,6 +1094,7 @@ namespace flecs {
         }
         
         flecs::query<Position, Velocity> q = world.query<Position, Velocity>();
+        PERF_ENTITY_COUNTERS(state, n / step);
         for (auto _ : state) {
             float accum = 0.f;
             q.each([&](Position &p, Velocity &v){ accum += p.x + p.y + p.z + v.vx + v.vy + v.vz; });
@@ -943,36 +1103,6 @@ namespace flecs {
     }
 }
 
-#define TO_FUNC_NAME(funcName, ecs) #ecs "....................." #funcName
-
-#define BENCH_ARGS(F, ECS, FUNC) \
-    F(ECS, FUNC, 1000) \
-    F(ECS, FUNC, 5000) \
-    F(ECS, FUNC, 50000) \
-    F(ECS, FUNC, 250000) \
-    F(ECS, FUNC, 500000) \
-    F(ECS, FUNC, 1000000)
-
-#define BENCH_ONE(ECS, FUNC, ARG) \
-    BENCHMARK(ECS::FUNC)->Name(TO_FUNC_NAME(FUNC, ECS))->Unit(benchmark::TimeUnit::kMicrosecond)->Arg(ARG)->MinTime(0.3);
-
-// MSVC has issues with std::atomic::wait()/notify_all() used in ecss_ts (thread-safe version)
-// Skip ecss_ts benchmarks on Windows to avoid hangs/crashes
-#ifdef _MSC_VER
-#define REGISTER_BENCHMARK(ecs0, ecs1, ecs2, ecs3, ecs4, FUNC) \
-    BENCH_ARGS(BENCH_ONE, ecs0, FUNC) \
-    BENCH_ARGS(BENCH_ONE, ecs1, FUNC) \
-    BENCH_ARGS(BENCH_ONE, ecs3, FUNC) \
-    BENCH_ARGS(BENCH_ONE, ecs4, FUNC)
-#else
-#define REGISTER_BENCHMARK(ecs0, ecs1, ecs2, ecs3, ecs4, FUNC) \
-    BENCH_ARGS(BENCH_ONE, ecs0, FUNC) \
-    BENCH_ARGS(BENCH_ONE, ecs1, FUNC) \
-    BENCH_ARGS(BENCH_ONE, ecs2, FUNC) \
-    BENCH_ARGS(BENCH_ONE, ecs3, FUNC) \
-    BENCH_ARGS(BENCH_ONE, ecs4, FUNC)
-#endif
-
 REGISTER_BENCHMARK(vec, ecss, ecss_ts, entt, flecs, insert)
 REGISTER_BENCHMARK(vec, ecss, ecss_ts, entt, flecs, create_entities)
 REGISTER_BENCHMARK(vec, ecss, ecss_ts, entt, flecs, add_int_component)
@@ -985,6 +1115,34 @@ REGISTER_BENCHMARK(vec, ecss, ecss_ts, entt, flecs, iter_grouped_multi)
 REGISTER_BENCHMARK(vec, ecss, ecss_ts, entt, flecs, iter_separate_multi)
 REGISTER_BENCHMARK(vec, ecss, ecss_ts, entt, flecs, iter_sparse_multi)
 
+// Construction benchmarks again on the arena allocator, side by side with the rows above.
+// The difference is global-allocator/page-fault cost; the arena hooks come with ECSS_BENCH_ARENA.
+#if ECSS_BENCH_ARENA
+REGISTER_ARENA_BENCHMARK(vec, ecss, ecss_ts, entt, flecs, insert)
+REGISTER_ARENA_BENCHMARK(vec, ecss, ecss_ts, entt, flecs, create_entities)
+REGISTER_ARENA_BENCHMARK(vec, ecss, ecss_ts, entt, flecs, add_int_component)
+REGISTER_ARENA_BENCHMARK(vec, ecss, ecss_ts, entt, flecs, grouped_insert)
+#endif
+
+// Iteration with the storage on 2 MiB pages preferred to the benchmark thread's NUMA node, against the
+// 4 KiB-page rows above; with ECSS_BENCH_PERF_COUNTERS both carry dtlb_misses_per_entity.
+#if ECSS_BENCH_ARENA && defined(__linux__)
+REGISTER_HUGEPAGES_BENCHMARK(vec, ecss, ecss_ts, entt, flecs, iter_single_component)
+#endif
+
+// Contention suite for the shared Registry<true>: ThreadRange gives 1, 2, 4, ... cores
+#define BENCH_CONTENDED(FUNC, ARG) \
+    BENCHMARK(ecss_ts_mt::FUNC)->Name(TO_FUNC_NAME(FUNC, ecss_ts))->Unit(benchmark::TimeUnit::kMicrosecond)->Arg(ARG) \
+        ->ThreadRange(1, ecss_ts_mt::maxThreads())->UseRealTime()->MinTime(0.3);
+
+// Same MSVC atomic wait/notify issue as above
+#ifndef _MSC_VER
+BENCH_CONTENDED(contended_take_add_destroy, 1000)
+BENCH_CONTENDED(contended_add_component, 1000)
+BENCH_CONTENDED(contended_view_each, 100000)
+BENCH_CONTENDED(contended_read_write, 100000)
+#endif
+
 #if ECSS_SINGLE_BENCHS
 BENCHMARK(ecss::insert)->Name(TO_FUNC_NAME(insert, ecss))->Unit(benchmark::TimeUnit::kMillisecond)->Arg(100'000'000);
 BENCHMARK(ecss::create_entities)->Name(TO_FUNC_NAME(create_entities, ecss))->Unit(benchmark::TimeUnit::kMillisecond)->Arg(100'000'000);
@@ -996,72 +1154,42 @@ BENCHMARK(ecss::destroy_entities)->Name(TO_FUNC_NAME(destroy_entities, ecss))->U
 BENCHMARK(ecss::iter_single_component)->Name(TO_FUNC_NAME(iter_single_component, ecss))->Unit(benchmark::TimeUnit::kMillisecond)->Arg(100'000'000);
 BENCHMARK(ecss::iter_grouped_multi)->Name(TO_FUNC_NAME(iter_grouped_multi, ecss))->Unit(benchmark::TimeUnit::kMillisecond)->Arg(100'000'000);
 BENCHMARK(ecss::iter_separate_multi)->Name(TO_FUNC_NAME(iter_separate_multi, ecss))->Unit(benchmark::TimeUnit::kMillisecond)->Arg(100'000'000);
+#if ECSS_BENCH_ARENA && defined(__linux__)
+BENCHMARK(memtrack::withHugePages<ecss::iter_single_component>)->Name(TO_FUNC_NAME(iter_single_component_hugepages, ecss))->Unit(benchmark::TimeUnit::kMillisecond)->Arg(100'000'000);
+#endif
 #endif
 
-// =====================================================================
-// REALISTIC GAME-LIKE BENCHMARK SCENARIOS
-// =====================================================================
-
-// Additional components for realistic scenarios
-struct Transform {
-    float x, y, z;           // position
-    float rx, ry, rz, rw;    // rotation quaternion
-    float sx, sy, sz;        // scale
-};
-
-struct RigidBody {
-    float vx, vy, vz;        // velocity
-    float ax, ay, az;        // acceleration
-    float mass;
-    float drag;
-};
-
-struct Health {
-    float current;
-    float max;
-    float regen;
-    bool isDead;
-};
-
-struct Damage {
-    float amount;
-    float armor;
-    float critChance;
-    float critMultiplier;
-};
-
-struct AIState {
-    int state;               // 0=idle, 1=patrol, 2=chase, 3=attack
-    float timer;
-    float aggroRange;
-    float attackRange;
-    uint32_t targetEntity;
-};
-
-struct Sprite {
-    uint32_t textureId;
-    float u0, v0, u1, v1;    // UV coords
-    uint32_t color;
-    int layer;
-};
+// Log-scale size sweep 1K..64M (x4 steps) for every backend, to find each library's cache cliff.
+// Rows carry working_set_bytes (component payload per iteration) and cache_tier (1-3 = L1-L3, 4 = DRAM)
+#if ECSS_SCALING_SWEEP
+#define BENCH_SWEEP_ONE(ECS, FUNC, BYTES) \
+    BENCHMARK(memtrack::tracked<cachetier::annotated<ECS::FUNC, BYTES>>)->Name(TO_FUNC_NAME(FUNC, ECS) "/sweep") \
+        ->Unit(benchmark::TimeUnit::kMicrosecond)->RangeMultiplier(4)->Range(1 << 10, 64 << 20)->MinTime(0.3);
 
-struct ParticleEmitter {
-    float emitRate;
-    float lifetime;
-    float timer;
-    int maxParticles;
-    int activeParticles;
-};
+#ifdef _MSC_VER
+#define REGISTER_SWEEP(ecs0, ecs1, ecs2, ecs3, ecs4, FUNC, BYTES) \
+    BENCH_SWEEP_ONE(ecs0, FUNC, BYTES) \
+    BENCH_SWEEP_ONE(ecs1, FUNC, BYTES) \
+    BENCH_SWEEP_ONE(ecs3, FUNC, BYTES) \
+    BENCH_SWEEP_ONE(ecs4, FUNC, BYTES)
+#else
+#define REGISTER_SWEEP(ecs0, ecs1, ecs2, ecs3, ecs4, FUNC, BYTES) \
+    BENCH_SWEEP_ONE(ecs0, FUNC, BYTES) \
+    BENCH_SWEEP_ONE(ecs1, FUNC, BYTES) \
+    BENCH_SWEEP_ONE(ecs2, FUNC, BYTES) \
+    BENCH_SWEEP_ONE(ecs3, FUNC, BYTES) \
+    BENCH_SWEEP_ONE(ecs4, FUNC, BYTES)
+#endif
 
-struct AABB {
-    float minX, minY, minZ;
-    float maxX, maxY, maxZ;
-};
+REGISTER_SWEEP(vec, ecss, ecss_ts, entt, flecs, iter_single_component, sizeof(Position))
+REGISTER_SWEEP(vec, ecss, ecss_ts, entt, flecs, iter_grouped_multi, sizeof(Position) + sizeof(Velocity))
+REGISTER_SWEEP(vec, ecss, ecss_ts, entt, flecs, iter_separate_multi, sizeof(Position) + sizeof(Velocity))
+#endif
 
-struct Tag_Player {};
-struct Tag_Enemy {};
-struct Tag_Projectile {};
-struct Tag_Static {};
+// =====================================================================
+// REALISTIC GAME-LIKE BENCHMARK SCENARIOS
+// Components live in components.h (shared with ecss_benchmarks_mt)
+// =====================================================================
 
 // =====================================================================
 // Scenario 1: Physics System - Position/Velocity/Acceleration integration
@@ -1095,7 +1223,9 @@ namespace ecss_r {
         const float dt = 1.f / 60.f;
         auto view = reg.view<Transform, RigidBody>();
         
-        for (auto _ : state) {
+        PERF_ENTITY_COUNTERS(state, n);
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("integrate");
             view.each([dt](Transform& t, RigidBody& rb) {
                 // Integrate velocity
                 rb.vx += rb.ax * dt;
@@ -1134,7 +1264,8 @@ namespace ecss_r {
         const float dt = 1.f / 60.f;
         auto view = reg.view<Health>();
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("regen");
             view.each([dt](Health& h) {
                 if (!h.isDead && h.current < h.max) {
                     h.current = std::min(h.max, h.current + h.regen * dt);
@@ -1170,7 +1301,8 @@ namespace ecss_r {
         const float dt = 1.f / 60.f;
         auto view = reg.view<Transform, AIState>();
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("ai");
             view.each([&](Transform& t, AIState& ai) {
                 ai.timer -= dt;
                 
@@ -1241,7 +1373,8 @@ namespace ecss_r {
         std::vector<BatchVertex> batch;
         batch.reserve(n * 4); // 4 vertices per sprite
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("sprite_batch");
             batch.clear();
             view.each([&](Transform& t, Sprite& s) {
                 // Generate quad vertices
@@ -1278,7 +1411,8 @@ namespace ecss_r {
         const float dt = 1.f / 60.f;
         auto view = reg.view<Position, Velocity>();
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("particles");
             view.each([dt](Position& p, Velocity& v) {
                 // Simple physics
                 v.vy -= 98.f * dt; // gravity
@@ -1323,33 +1457,37 @@ namespace ecss_r {
             return (float)(seed % 1000) / 1000.f;
         };
         
-        for (auto _ : state) {
-            view.each([&](Health& h, Damage& d) {
-                if (h.isDead) return;
+        latency::Frames frames(state);
+        for (auto _ : frames) {
+            {
+                TRACE_ZONE("damage");
+                view.each([&](Health& h, Damage& d) {
+                    if (h.isDead) return;
                 
-                float finalDamage = d.amount - d.armor * 0.5f;
-                if (finalDamage < 1.f) finalDamage = 1.f;
+                    float finalDamage = d.amount - d.armor * 0.5f;
+                    if (finalDamage < 1.f) finalDamage = 1.f;
                 
-                // Crit check
-                if (pseudoRandom() < d.critChance) {
-                    finalDamage *= d.critMultiplier;
-                }
+                    // Crit check
+                    if (pseudoRandom() < d.critChance) {
+                        finalDamage *= d.critMultiplier;
+                    }
                 
-                h.current -= finalDamage;
-                if (h.current <= 0.f) {
-                    h.current = 0.f;
-                    h.isDead = true;
-                }
-            });
-            benchmark::ClobberMemory();
+                    h.current -= finalDamage;
+                    if (h.current <= 0.f) {
+                        h.current = 0.f;
+                        h.isDead = true;
+                    }
+                });
+                benchmark::ClobberMemory();
+            }
             
             // Reset for next iteration
-            state.PauseTiming();
+            frames.pauseTiming();
             view.each([](Health& h, Damage&) {
                 h.current = h.max;
                 h.isDead = false;
             });
-            state.ResumeTiming();
+            frames.resumeTiming();
         }
     }
 
@@ -1377,7 +1515,8 @@ namespace ecss_r {
         
         auto view = reg.view<AABB>();
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("broadphase");
             // Just update AABBs from transforms and count potential overlaps
             size_t overlaps = 0;
             float lastMaxX = -1e9f;
@@ -1412,34 +1551,43 @@ namespace ecss_r {
         }
         
         int frameCounter = 0;
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
             // Destroy oldest entities
-            std::vector<ecss::EntityId> toDestroy;
-            toDestroy.reserve(churnRate);
-            for (int i = 0; i < churnRate && !entities.empty(); ++i) {
-                toDestroy.push_back(entities[i]);
-            }
-            if (!toDestroy.empty()) {
-                reg.destroyEntities(toDestroy);
-                entities.erase(entities.begin(), entities.begin() + toDestroy.size());
+            {
+                TRACE_ZONE("destroy");
+                std::vector<ecss::EntityId> toDestroy;
+                toDestroy.reserve(churnRate);
+                for (int i = 0; i < churnRate && !entities.empty(); ++i) {
+                    toDestroy.push_back(entities[i]);
+                }
+                if (!toDestroy.empty()) {
+                    reg.destroyEntities(toDestroy);
+                    entities.erase(entities.begin(), entities.begin() + toDestroy.size());
+                }
             }
-            
+
             // Spawn new entities
-            for (int i = 0; i < churnRate; ++i) {
-                auto e = reg.takeEntity();
-                reg.addComponent<Position>(e, Position{(float)frameCounter, (float)i, 0.f});
-                reg.addComponent<Velocity>(e, Velocity{1.f, 0.f, 0.f});
-                entities.push_back(e);
+            {
+                TRACE_ZONE("spawn");
+                for (int i = 0; i < churnRate; ++i) {
+                    auto e = reg.takeEntity();
+                    reg.addComponent<Position>(e, Position{(float)frameCounter, (float)i, 0.f});
+                    reg.addComponent<Velocity>(e, Velocity{1.f, 0.f, 0.f});
+                    entities.push_back(e);
+                }
             }
-            
+
             // Update physics
-            auto view = reg.view<Position, Velocity>();
-            view.each([](Position& p, Velocity& v) {
-                p.x += v.vx;
-                p.y += v.vy;
-                p.z += v.vz;
-            });
-            
+            {
+                TRACE_ZONE("movement");
+                auto view = trace::timed("movement_view", [&] { return reg.view<Position, Velocity>(); });
+                view.each([](Position& p, Velocity& v) {
+                    p.x += v.vx;
+                    p.y += v.vy;
+                    p.z += v.vz;
+                });
+            }
+
             frameCounter++;
             benchmark::ClobberMemory();
         }
@@ -1476,21 +1624,23 @@ namespace ecss_r {
         
         const float dt = 1.f / 60.f;
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
             // Physics system (Transform + RigidBody)
             {
-                auto view = reg.view<Transform, RigidBody>();
+                TRACE_ZONE("physics");
+                auto view = trace::timed("physics_view", [&] { return reg.view<Transform, RigidBody>(); });
                 view.each([dt](Transform& t, RigidBody& rb) {
                     rb.vy += rb.ay * dt;
                     t.x += rb.vx * dt;
                     t.y += rb.vy * dt;
                 });
             }
-            
+
             // Render prep (Transform + Sprite)
             {
+                TRACE_ZONE("render_prep");
                 float accum = 0.f;
-                auto view = reg.view<Transform, Sprite>();
+                auto view = trace::timed("render_prep_view", [&] { return reg.view<Transform, Sprite>(); });
                 view.each([&](Transform& t, Sprite& s) {
                     accum += t.x * (float)s.layer;
                 });
@@ -1517,13 +1667,15 @@ namespace ecss_r {
         }
         
         bool hasVelocity = false;
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
             if (!hasVelocity) {
+                TRACE_ZONE("add_velocity");
                 // Add Velocity to all entities
                 for (auto e : entities) {
                     reg.addComponent<Velocity>(e, Velocity{1.f, 2.f, 3.f});
                 }
             } else {
+                TRACE_ZONE("remove_velocity");
                 // Remove Velocity from all entities
                 for (auto e : entities) {
                     reg.destroyComponent<Velocity>(e);
@@ -1534,6 +1686,44 @@ namespace ecss_r {
         }
     }
 
+    // Add/remove family - Payload<Bytes> migrates on/off range(1)% of the entities every frame,
+    // optionally grouped with Position through registerArray
+    template <size_t Bytes, bool Grouped>
+    static void add_remove_sized(benchmark::State& state) {
+        Reg reg;
+        if constexpr (Grouped) {
+            reg.registerArray<Position, Payload<Bytes>>();
+        }
+        const int n = state.range(0);
+        const int stride = std::max<int>(1, 100 / state.range(1));
+
+        std::vector<ecss::EntityId> touched;
+        touched.reserve(n / stride + 1);
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            reg.addComponent<Position>(e, Position{(float)i, 0.f, 0.f});
+            if (i % stride == 0) {
+                touched.push_back(e);
+            }
+        }
+
+        bool hasPayload = false;
+        for (auto _ : state) {
+            if (!hasPayload) {
+                for (auto e : touched) {
+                    reg.addComponent<Payload<Bytes>>(e, Payload<Bytes>{});
+                }
+            } else {
+                for (auto e : touched) {
+                    reg.destroyComponent<Payload<Bytes>>(e);
+                }
+            }
+            hasPayload = !hasPayload;
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(touched.size()));
+    }
+
 } // namespace ecss_r
 
 namespace entt_r {
@@ -1560,7 +1750,9 @@ namespace entt_r {
         const float dt = 1.f / 60.f;
         auto view = reg.view<Transform, RigidBody>();
         
-        for (auto _ : state) {
+        PERF_ENTITY_COUNTERS(state, n);
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("integrate");
             view.each([dt](Transform& t, RigidBody& rb) {
                 rb.vx += rb.ax * dt;
                 rb.vy += rb.ay * dt;
@@ -1590,7 +1782,8 @@ namespace entt_r {
         const float dt = 1.f / 60.f;
         auto view = reg.view<Health>();
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("regen");
             view.each([dt](Health& h) {
                 if (!h.isDead && h.current < h.max) {
                     h.current = std::min(h.max, h.current + h.regen * dt);
@@ -1619,7 +1812,8 @@ namespace entt_r {
         const float dt = 1.f / 60.f;
         auto view = reg.view<Transform, AIState>();
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("ai");
             view.each([&](Transform& t, AIState& ai) {
                 ai.timer -= dt;
                 float dx = playerX - t.x;
@@ -1668,7 +1862,8 @@ namespace entt_r {
         std::vector<BatchVertex> batch;
         batch.reserve(n * 4);
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("sprite_batch");
             batch.clear();
             view.each([&](Transform& t, Sprite& s) {
                 batch.push_back({t.x, t.y, s.u0, s.v0, s.color});
@@ -1695,7 +1890,8 @@ namespace entt_r {
         const float dt = 1.f / 60.f;
         auto view = reg.view<Position, Velocity>();
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("particles");
             view.each([dt](Position& p, Velocity& v) {
                 v.vy -= 98.f * dt;
                 p.x += v.vx * dt;
@@ -1729,20 +1925,24 @@ namespace entt_r {
             return (float)(seed % 1000) / 1000.f;
         };
         
-        for (auto _ : state) {
-            view.each([&](Health& h, Damage& d) {
-                if (h.isDead) return;
-                float finalDamage = d.amount - d.armor * 0.5f;
-                if (finalDamage < 1.f) finalDamage = 1.f;
-                if (pseudoRandom() < d.critChance) finalDamage *= d.critMultiplier;
-                h.current -= finalDamage;
-                if (h.current <= 0.f) { h.current = 0.f; h.isDead = true; }
-            });
-            benchmark::ClobberMemory();
+        latency::Frames frames(state);
+        for (auto _ : frames) {
+            {
+                TRACE_ZONE("damage");
+                view.each([&](Health& h, Damage& d) {
+                    if (h.isDead) return;
+                    float finalDamage = d.amount - d.armor * 0.5f;
+                    if (finalDamage < 1.f) finalDamage = 1.f;
+                    if (pseudoRandom() < d.critChance) finalDamage *= d.critMultiplier;
+                    h.current -= finalDamage;
+                    if (h.current <= 0.f) { h.current = 0.f; h.isDead = true; }
+                });
+                benchmark::ClobberMemory();
+            }
             
-            state.PauseTiming();
+            frames.pauseTiming();
             view.each([](Health& h, Damage&) { h.current = h.max; h.isDead = false; });
-            state.ResumeTiming();
+            frames.resumeTiming();
         }
     }
 
@@ -1761,7 +1961,8 @@ namespace entt_r {
         
         auto view = reg.view<AABB>();
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("broadphase");
             size_t overlaps = 0;
             float lastMaxX = -1e9f;
             view.each([&](AABB& a) {
@@ -1788,26 +1989,35 @@ namespace entt_r {
         }
         
         int frameCounter = 0;
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
             // Destroy oldest
-            for (int i = 0; i < churnRate && !entities.empty(); ++i) {
-                reg.destroy(entities[i]);
+            {
+                TRACE_ZONE("destroy");
+                for (int i = 0; i < churnRate && !entities.empty(); ++i) {
+                    reg.destroy(entities[i]);
+                }
+                entities.erase(entities.begin(), entities.begin() + std::min(churnRate, (int)entities.size()));
             }
-            entities.erase(entities.begin(), entities.begin() + std::min(churnRate, (int)entities.size()));
-            
+
             // Spawn new
-            for (int i = 0; i < churnRate; ++i) {
-                auto e = reg.create();
-                reg.emplace<Position>(e, Position{(float)frameCounter, (float)i, 0.f});
-                reg.emplace<Velocity>(e, Velocity{1.f, 0.f, 0.f});
-                entities.push_back(e);
+            {
+                TRACE_ZONE("spawn");
+                for (int i = 0; i < churnRate; ++i) {
+                    auto e = reg.create();
+                    reg.emplace<Position>(e, Position{(float)frameCounter, (float)i, 0.f});
+                    reg.emplace<Velocity>(e, Velocity{1.f, 0.f, 0.f});
+                    entities.push_back(e);
+                }
             }
-            
-            auto view = reg.view<Position, Velocity>();
-            view.each([](Position& p, Velocity& v) {
-                p.x += v.vx; p.y += v.vy; p.z += v.vz;
-            });
-            
+
+            {
+                TRACE_ZONE("movement");
+                auto view = trace::timed("movement_view", [&] { return reg.view<Position, Velocity>(); });
+                view.each([](Position& p, Velocity& v) {
+                    p.x += v.vx; p.y += v.vy; p.z += v.vz;
+                });
+            }
+
             frameCounter++;
             benchmark::ClobberMemory();
         }
@@ -1827,9 +2037,10 @@ namespace entt_r {
         
         const float dt = 1.f / 60.f;
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
             {
-                auto view = reg.view<Transform, RigidBody>();
+                TRACE_ZONE("physics");
+                auto view = trace::timed("physics_view", [&] { return reg.view<Transform, RigidBody>(); });
                 view.each([dt](Transform& t, RigidBody& rb) {
                     rb.vy += rb.ay * dt;
                     t.x += rb.vx * dt;
@@ -1837,8 +2048,9 @@ namespace entt_r {
                 });
             }
             {
+                TRACE_ZONE("render_prep");
                 float accum = 0.f;
-                auto view = reg.view<Transform, Sprite>();
+                auto view = trace::timed("render_prep_view", [&] { return reg.view<Transform, Sprite>(); });
                 view.each([&](Transform& t, Sprite& s) { accum += t.x * (float)s.layer; });
                 benchmark::DoNotOptimize(accum);
             }
@@ -1860,12 +2072,14 @@ namespace entt_r {
         }
         
         bool hasVelocity = false;
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
             if (!hasVelocity) {
+                TRACE_ZONE("add_velocity");
                 for (auto e : entities) {
                     reg.emplace<Velocity>(e, Velocity{1.f, 2.f, 3.f});
                 }
             } else {
+                TRACE_ZONE("remove_velocity");
                 for (auto e : entities) {
                     reg.remove<Velocity>(e);
                 }
@@ -1875,6 +2089,39 @@ namespace entt_r {
         }
     }
 
+    template <size_t Bytes>
+    static void add_remove_sized(benchmark::State& state) {
+        big_registry reg;
+        const int n = state.range(0);
+        const int stride = std::max<int>(1, 100 / state.range(1));
+
+        std::vector<entt::entity> touched;
+        touched.reserve(n / stride + 1);
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.create();
+            reg.emplace<Position>(e, Position{(float)i, 0.f, 0.f});
+            if (i % stride == 0) {
+                touched.push_back(e);
+            }
+        }
+
+        bool hasPayload = false;
+        for (auto _ : state) {
+            if (!hasPayload) {
+                for (auto e : touched) {
+                    reg.emplace<Payload<Bytes>>(e);
+                }
+            } else {
+                for (auto e : touched) {
+                    reg.remove<Payload<Bytes>>(e);
+                }
+            }
+            hasPayload = !hasPayload;
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(touched.size()));
+    }
+
 } // namespace entt_r
 
 namespace flecs_r {
@@ -1895,7 +2142,9 @@ namespace flecs_r {
         const float dt = 1.f / 60.f;
         auto q = world.query<Transform, RigidBody>();
         
-        for (auto _ : state) {
+        PERF_ENTITY_COUNTERS(state, n);
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("integrate");
             q.each([dt](Transform& t, RigidBody& rb) {
                 rb.vx += rb.ax * dt;
                 rb.vy += rb.ay * dt;
@@ -1923,7 +2172,8 @@ namespace flecs_r {
         const float dt = 1.f / 60.f;
         auto q = world.query<Health>();
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("regen");
             q.each([dt](Health& h) {
                 if (!h.isDead && h.current < h.max) {
                     h.current = std::min(h.max, h.current + h.regen * dt);
@@ -1949,7 +2199,8 @@ namespace flecs_r {
         const float dt = 1.f / 60.f;
         auto q = world.query<Transform, AIState>();
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("ai");
             q.each([&](Transform& t, AIState& ai) {
                 ai.timer -= dt;
                 float dx = playerX - t.x;
@@ -1995,7 +2246,8 @@ namespace flecs_r {
         std::vector<BatchVertex> batch;
         batch.reserve(n * 4);
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("sprite_batch");
             batch.clear();
             q.each([&](Transform& t, Sprite& s) {
                 batch.push_back({t.x, t.y, s.u0, s.v0, s.color});
@@ -2024,7 +2276,8 @@ namespace flecs_r {
         const float dt = 1.f / 60.f;
         auto q = world.query<Position, Velocity>();
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("particles");
             q.each([dt](Position& p, Velocity& v) {
                 v.vy -= 98.f * dt;
                 p.x += v.vx * dt;
@@ -2057,20 +2310,24 @@ namespace flecs_r {
             return (float)(seed % 1000) / 1000.f;
         };
         
-        for (auto _ : state) {
-            q.each([&](Health& h, Damage& d) {
-                if (h.isDead) return;
-                float finalDamage = d.amount - d.armor * 0.5f;
-                if (finalDamage < 1.f) finalDamage = 1.f;
-                if (pseudoRandom() < d.critChance) finalDamage *= d.critMultiplier;
-                h.current -= finalDamage;
-                if (h.current <= 0.f) { h.current = 0.f; h.isDead = true; }
-            });
-            benchmark::ClobberMemory();
+        latency::Frames frames(state);
+        for (auto _ : frames) {
+            {
+                TRACE_ZONE("damage");
+                q.each([&](Health& h, Damage& d) {
+                    if (h.isDead) return;
+                    float finalDamage = d.amount - d.armor * 0.5f;
+                    if (finalDamage < 1.f) finalDamage = 1.f;
+                    if (pseudoRandom() < d.critChance) finalDamage *= d.critMultiplier;
+                    h.current -= finalDamage;
+                    if (h.current <= 0.f) { h.current = 0.f; h.isDead = true; }
+                });
+                benchmark::ClobberMemory();
+            }
             
-            state.PauseTiming();
+            frames.pauseTiming();
             q.each([](Health& h, Damage&) { h.current = h.max; h.isDead = false; });
-            state.ResumeTiming();
+            frames.resumeTiming();
         }
     }
 
@@ -2091,7 +2348,8 @@ namespace flecs_r {
         
         auto q = world.query<AABB>();
         
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
+            TRACE_ZONE("broadphase");
             size_t overlaps = 0;
             float lastMaxX = -1e9f;
             q.each([&](AABB& a) {
@@ -2121,24 +2379,33 @@ namespace flecs_r {
         auto q = world.query<Position, Velocity>();
         int frameCounter = 0;
         
-        for (auto _ : state) {
-            world.defer_begin();
-            for (int i = 0; i < churnRate && !entities.empty(); ++i) {
-                entities[i].destruct();
+        for (auto _ : latency::Frames(state)) {
+            {
+                TRACE_ZONE("destroy");
+                world.defer_begin();
+                for (int i = 0; i < churnRate && !entities.empty(); ++i) {
+                    entities[i].destruct();
+                }
+                world.defer_end();
+                entities.erase(entities.begin(), entities.begin() + std::min(churnRate, (int)entities.size()));
             }
-            world.defer_end();
-            entities.erase(entities.begin(), entities.begin() + std::min(churnRate, (int)entities.size()));
-            
-            for (int i = 0; i < churnRate; ++i) {
-                entities.push_back(world.entity()
-                    .set<Position>({(float)frameCounter, (float)i, 0.f})
-                    .set<Velocity>({1.f, 0.f, 0.f}));
+
+            {
+                TRACE_ZONE("spawn");
+                for (int i = 0; i < churnRate; ++i) {
+                    entities.push_back(world.entity()
+                        .set<Position>({(float)frameCounter, (float)i, 0.f})
+                        .set<Velocity>({1.f, 0.f, 0.f}));
+                }
             }
-            
-            q.each([](Position& p, Velocity& v) {
-                p.x += v.vx; p.y += v.vy; p.z += v.vz;
-            });
-            
+
+            {
+                TRACE_ZONE("movement");
+                q.each([](Position& p, Velocity& v) {
+                    p.x += v.vx; p.y += v.vy; p.z += v.vz;
+                });
+            }
+
             frameCounter++;
             benchmark::ClobberMemory();
         }
@@ -2162,16 +2429,21 @@ namespace flecs_r {
         auto qPhys = world.query<Transform, RigidBody>();
         auto qRender = world.query<Transform, Sprite>();
         
-        for (auto _ : state) {
-            qPhys.each([dt](Transform& t, RigidBody& rb) {
-                rb.vy += rb.ay * dt;
-                t.x += rb.vx * dt;
-                t.y += rb.vy * dt;
-            });
-            
-            float accum = 0.f;
-            qRender.each([&](Transform& t, Sprite& s) { accum += t.x * (float)s.layer; });
-            benchmark::DoNotOptimize(accum);
+        for (auto _ : latency::Frames(state)) {
+            {
+                TRACE_ZONE("physics");
+                qPhys.each([dt](Transform& t, RigidBody& rb) {
+                    rb.vy += rb.ay * dt;
+                    t.x += rb.vx * dt;
+                    t.y += rb.vy * dt;
+                });
+            }
+            {
+                TRACE_ZONE("render_prep");
+                float accum = 0.f;
+                qRender.each([&](Transform& t, Sprite& s) { accum += t.x * (float)s.layer; });
+                benchmark::DoNotOptimize(accum);
+            }
             benchmark::ClobberMemory();
         }
     }
@@ -2190,12 +2462,14 @@ namespace flecs_r {
         }
         
         bool hasVelocity = false;
-        for (auto _ : state) {
+        for (auto _ : latency::Frames(state)) {
             if (!hasVelocity) {
+                TRACE_ZONE("add_velocity");
                 for (auto& e : entities) {
                     e.set<Velocity>({1.f, 2.f, 3.f});
                 }
             } else {
+                TRACE_ZONE("remove_velocity");
                 for (auto& e : entities) {
                     e.remove<Velocity>();
                 }
@@ -2205,23 +2479,44 @@ namespace flecs_r {
         }
     }
 
-} // namespace flecs_r
-} // namespace realistic
+    template <size_t Bytes>
+    static void add_remove_sized(benchmark::State& state) {
+        flecs_world world;
+        world.component<Position>();
+        world.component<Payload<Bytes>>();
+        const int n = state.range(0);
+        const int stride = std::max<int>(1, 100 / state.range(1));
 
-// Register realistic benchmarks
-#define BENCH_REALISTIC_ARGS(F, ECS, FUNC) \
-    F(ECS, FUNC, 1000) \
-    F(ECS, FUNC, 100000) \
-    F(ECS, FUNC, 1000000)
+        std::vector<flecs::entity> touched;
+        touched.reserve(n / stride + 1);
+        for (int i = 0; i < n; ++i) {
+            auto e = world.entity().set<Position>({(float)i, 0.f, 0.f});
+            if (i % stride == 0) {
+                touched.push_back(e);
+            }
+        }
 
-#define BENCH_REALISTIC_ONE(ECS, FUNC, ARG) \
-    BENCHMARK(realistic::ECS::FUNC)->Name("realistic/" #ECS "/" #FUNC)->Unit(benchmark::TimeUnit::kMicrosecond)->Arg(ARG)->MinTime(0.3);
+        bool hasPayload = false;
+        for (auto _ : state) {
+            if (!hasPayload) {
+                for (auto& e : touched) {
+                    e.set<Payload<Bytes>>(Payload<Bytes>{});
+                }
+            } else {
+                for (auto& e : touched) {
+                    e.remove<Payload<Bytes>>();
+                }
+            }
+            hasPayload = !hasPayload;
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(touched.size()));
+    }
 
-#define REGISTER_REALISTIC(ecs1, ecs2, ecs3, FUNC) \
-    BENCH_REALISTIC_ARGS(BENCH_REALISTIC_ONE, ecs1, FUNC) \
-    BENCH_REALISTIC_ARGS(BENCH_REALISTIC_ONE, ecs2, FUNC) \
-    BENCH_REALISTIC_ARGS(BENCH_REALISTIC_ONE, ecs3, FUNC)
+} // namespace flecs_r
+} // namespace realistic
 
+// Register realistic benchmarks
 REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, physics_integration)
 REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, health_regen)
 REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, ai_state_machine)
@@ -2230,4 +2525,40 @@ REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, combat_damage)
 REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, collision_broadphase)
 REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, entity_churn)
 REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, mixed_archetypes)
-REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, add_remove_component)
\ No newline at end of file
+REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, add_remove_component)
+REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, particle_system)
+
+// Same scenarios, per-frame latency distribution (frame spikes from structural changes, sector growth)
+REGISTER_REALISTIC_LATENCY(ecss_r, entt_r, flecs_r, physics_integration)
+REGISTER_REALISTIC_LATENCY(ecss_r, entt_r, flecs_r, health_regen)
+REGISTER_REALISTIC_LATENCY(ecss_r, entt_r, flecs_r, ai_state_machine)
+REGISTER_REALISTIC_LATENCY(ecss_r, entt_r, flecs_r, sprite_batching)
+REGISTER_REALISTIC_LATENCY(ecss_r, entt_r, flecs_r, combat_damage)
+REGISTER_REALISTIC_LATENCY(ecss_r, entt_r, flecs_r, collision_broadphase)
+REGISTER_REALISTIC_LATENCY(ecss_r, entt_r, flecs_r, entity_churn)
+REGISTER_REALISTIC_LATENCY(ecss_r, entt_r, flecs_r, mixed_archetypes)
+REGISTER_REALISTIC_LATENCY(ecss_r, entt_r, flecs_r, add_remove_component)
+REGISTER_REALISTIC_LATENCY(ecss_r, entt_r, flecs_r, particle_system)
+
+// physics_integration with its storage on the huge-page arena, against the default-page rows above
+#if ECSS_BENCH_ARENA && defined(__linux__)
+REGISTER_REALISTIC_HUGEPAGES(ecss_r, entt_r, flecs_r, physics_integration)
+#endif
+
+// Migration family: component size x fraction of entities touched per frame (x grouping for ecss)
+// realistic/<ecs>/add_remove_component_<bytes>b[_grouped]/<entities>/touched_pct:<pct>
+#define BENCH_ADD_REMOVE_SIZED(ECS, NAME, ...) \
+    BENCHMARK(memtrack::tracked<realistic::ECS::add_remove_sized<__VA_ARGS__>>)->Name("realistic/" #ECS "/" NAME) \
+        ->Unit(benchmark::TimeUnit::kMicrosecond)->ArgsProduct({{10000, 100000}, {1, 10, 100}})->ArgNames({"", "touched_pct"})->MinTime(0.3);
+
+#define REGISTER_ADD_REMOVE_SIZED(BYTES) \
+    BENCH_ADD_REMOVE_SIZED(ecss_r, "add_remove_component_" #BYTES "b", BYTES, false) \
+    BENCH_ADD_REMOVE_SIZED(ecss_r, "add_remove_component_" #BYTES "b_grouped", BYTES, true) \
+    BENCH_ADD_REMOVE_SIZED(entt_r, "add_remove_component_" #BYTES "b", BYTES) \
+    BENCH_ADD_REMOVE_SIZED(flecs_r, "add_remove_component_" #BYTES "b", BYTES)
+
+REGISTER_ADD_REMOVE_SIZED(12)
+REGISTER_ADD_REMOVE_SIZED(32)
+REGISTER_ADD_REMOVE_SIZED(64)
+REGISTER_ADD_REMOVE_SIZED(128)
+REGISTER_ADD_REMOVE_SIZED(256)
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <vector>
+
+#include "components.h"
+#include "registration.h"
+
+// Level-load style spawning: all state.range(0) entities in one burst, through each library's batched path.
+// bulk_insert / bulk_grouped_insert pair with the per-entity insert / grouped_insert rows (same values).
+namespace {
+    // ECSS has no bulk API: ids are reserved in one pass, then each component is filled in ascending id
+    // order, one type at a time, so every sector append lands on the tail that was just written.
+    template <bool ThreadSafe, bool Grouped>
+    void ecssBulkSpawn(benchmark::State& state) {
+        using Reg = ecss::Registry<ThreadSafe>;
+        const auto n = static_cast<size_t>(state.range(0));
+        std::vector<ecss::EntityId> ids(n);
+        for (auto _ : state) {
+            Reg reg;
+            if constexpr (Grouped) {
+                reg.template registerArray<Position, Velocity>();
+            }
+            for (auto& id : ids) {
+                id = reg.takeEntity();
+            }
+            for (auto id : ids) {
+                reg.template addComponent<Position>(id, Grouped ? Position{ 7.f, 8.f, 9.f } : Position{ 42.f, 42.f, 42.f });
+            }
+            if constexpr (Grouped) {
+                for (auto id : ids) {
+                    reg.template addComponent<Velocity>(id, Velocity{ 1.f, 2.f, 3.f });
+                }
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+namespace ecss
+{
+    // Reserve ids, then fill Position
+    static void bulk_insert(benchmark::State& state) {
+        ecssBulkSpawn<false, false>(state);
+    }
+
+    // Reserve ids, then fill the grouped Position + Velocity array type by type
+    static void bulk_grouped_insert(benchmark::State& state) {
+        ecssBulkSpawn<false, true>(state);
+    }
+}
+
+namespace ecss_ts
+{
+    static void bulk_insert(benchmark::State& state) {
+        ecssBulkSpawn<true, false>(state);
+    }
+
+    static void bulk_grouped_insert(benchmark::State& state) {
+        ecssBulkSpawn<true, true>(state);
+    }
+}
+
+namespace entt
+{
+    // create(first, last) + insert(first, last, value)
+    static void bulk_insert(benchmark::State& state) {
+        std::vector<entt::entity> ids(static_cast<size_t>(state.range(0)));
+        for (auto _ : state) {
+            entt::registry reg;
+            reg.create(ids.begin(), ids.end());
+            reg.insert<Position>(ids.begin(), ids.end(), Position{ 42.f, 42.f, 42.f });
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    static void bulk_grouped_insert(benchmark::State& state) {
+        std::vector<entt::entity> ids(static_cast<size_t>(state.range(0)));
+        for (auto _ : state) {
+            entt::registry reg;
+            reg.create(ids.begin(), ids.end());
+            reg.insert<Position>(ids.begin(), ids.end(), Position{ 7.f, 8.f, 9.f });
+            reg.insert<Velocity>(ids.begin(), ids.end(), Velocity{ 1.f, 2.f, 3.f });
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+namespace flecs
+{
+    // ecs_bulk_init: one table move for the whole batch, component data copied from column arrays
+    static void bulk_insert(benchmark::State& state) {
+        const auto n = static_cast<int32_t>(state.range(0));
+        std::vector<Position> positions(n, Position{ 42.f, 42.f, 42.f });
+        for (auto _ : state) {
+            flecs::world world;
+            void* data[] = { positions.data() };
+            ecs_bulk_desc_t desc = {};
+            desc.count = n;
+            desc.ids[0] = world.component<Position>().id();
+            desc.data = data;
+            benchmark::DoNotOptimize(ecs_bulk_init(world, &desc));
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    static void bulk_grouped_insert(benchmark::State& state) {
+        const auto n = static_cast<int32_t>(state.range(0));
+        std::vector<Position> positions(n, Position{ 7.f, 8.f, 9.f });
+        std::vector<Velocity> velocities(n, Velocity{ 1.f, 2.f, 3.f });
+        for (auto _ : state) {
+            flecs::world world;
+            void* data[] = { positions.data(), velocities.data() };
+            ecs_bulk_desc_t desc = {};
+            desc.count = n;
+            desc.ids[0] = world.component<Position>().id();
+            desc.ids[1] = world.component<Velocity>().id();
+            desc.data = data;
+            benchmark::DoNotOptimize(ecs_bulk_init(world, &desc));
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+// No vec rows: a plain array has no per-entity vs batched path to compare
+#ifdef _MSC_VER
+#define REGISTER_BULK_BENCHMARK(FUNC) \
+    BENCH_ARGS(BENCH_ONE, ecss, FUNC) \
+    BENCH_ARGS(BENCH_ONE, entt, FUNC) \
+    BENCH_ARGS(BENCH_ONE, flecs, FUNC)
+#else
+#define REGISTER_BULK_BENCHMARK(FUNC) \
+    BENCH_ARGS(BENCH_ONE, ecss, FUNC) \
+    BENCH_ARGS(BENCH_ONE, ecss_ts, FUNC) \
+    BENCH_ARGS(BENCH_ONE, entt, FUNC) \
+    BENCH_ARGS(BENCH_ONE, flecs, FUNC)
+#endif
+
+REGISTER_BULK_BENCHMARK(bulk_insert)
+REGISTER_BULK_BENCHMARK(bulk_grouped_insert)
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+// Cache-tier annotation for size sweeps.
+// Data cache sizes come from google benchmark's CPUInfo (read once at startup, same source as the
+// "CPU Caches" header it prints), so the tiers match the machine that produced the JSON.
+namespace cachetier {
+    struct Sizes {
+        int64_t l1 = 0;
+        int64_t l2 = 0;
+        int64_t l3 = 0;
+    };
+
+    inline const Sizes& sizes() {
+        static const Sizes detected = [] {
+            Sizes s;
+            for (const auto& cache : benchmark::CPUInfo::Get().caches) {
+                if (cache.type == "Instruction") {
+                    continue;
+                }
+                const int64_t size = cache.size;
+                switch (cache.level) {
+                    case 1: s.l1 = std::max(s.l1, size); break;
+                    case 2: s.l2 = std::max(s.l2, size); break;
+                    case 3: s.l3 = std::max(s.l3, size); break;
+                    default: break;
+                }
+            }
+            return s;
+        }();
+        return detected;
+    }
+
+    // 1 = L1, 2 = L2, 3 = L3, 4 = DRAM. Levels the CPU does not report are skipped.
+    inline int tierFor(int64_t bytes) {
+        const Sizes& s = sizes();
+        if (s.l1 > 0 && bytes <= s.l1) return 1;
+        if (s.l2 > 0 && bytes <= s.l2) return 2;
+        if (s.l3 > 0 && bytes <= s.l3) return 3;
+        return 4;
+    }
+
+    // Evicts the data caches by writing one byte per line of a buffer twice the last level's size
+    // (at least 8 MiB). Tens of milliseconds: call it with the timer paused. The buffer comes from
+    // calloc, so memory tracking does not charge it to the first benchmark that flushes.
+    inline void flushCaches() {
+        static const size_t bytes = static_cast<size_t>(std::max<int64_t>(8 << 20, 2 * std::max({ sizes().l1, sizes().l2, sizes().l3 })));
+        static unsigned char* const buffer = static_cast<unsigned char*>(std::calloc(bytes, 1));
+        static unsigned char round = 0;
+        if (!buffer) {
+            return;
+        }
+        ++round;
+        for (size_t i = 0; i < bytes; i += 64) {
+            buffer[i] += round;
+        }
+        benchmark::DoNotOptimize(buffer);
+        benchmark::ClobberMemory();
+    }
+
+    // Runs a benchmark whose state.range(0) is the entity count and attaches
+    //  working_set_bytes - component payload touched per iteration (BytesPerEntity * entities)
+    //  cache_tier        - tierFor(working_set_bytes)
+    template <void (*Func)(benchmark::State&), int64_t BytesPerEntity>
+    void annotated(benchmark::State& state) {
+        Func(state);
+        const int64_t workingSet = BytesPerEntity * state.range(0);
+        state.counters["working_set_bytes"] = benchmark::Counter(static_cast<double>(workingSet), benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
+        state.counters["cache_tier"] = tierFor(workingSet);
+    }
+}
@@ -0,0 +1,257 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "components.h"
+#include "registration.h"
+
+// Dirty tracking: each frame a writer moves range(1) per mille of the Transforms (random entities), then a
+// replication-style reader visits what changed since the last frame and folds it into a checksum.
+//  visited_per_frame - entities the reader touched to find the changed ones
+// items_per_second counts written entities.
+namespace {
+    constexpr uint32_t kDirtySeed = 0xD1E7;
+
+    size_t writesPerFrame(const benchmark::State& state) {
+        return std::max<size_t>(1, static_cast<size_t>(state.range(0) * state.range(1) / 1000));
+    }
+
+    void reportDirty(benchmark::State& state, size_t writes, double visitedPerFrame) {
+        state.counters["visited_per_frame"] = visitedPerFrame;
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(writes));
+    }
+
+    Transform initialTransform(int i) {
+        return Transform{ (float)i, 0.f, 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f };
+    }
+
+    void moveTransform(Transform& t) {
+        t.x += 1.f;
+        t.y += 0.5f;
+    }
+
+    float replicate(const Transform& t) {
+        return t.x + t.y + t.z;
+    }
+
+    // One bit per entity id next to the registry, walked a word at a time
+    class DirtyBits {
+    public:
+        explicit DirtyBits(size_t ids) : mWords((ids + 63) / 64, 0) {}
+
+        void mark(size_t id) {
+            if (id / 64 >= mWords.size()) {
+                mWords.resize(id / 64 + 1, 0);
+            }
+            mWords[id / 64] |= uint64_t(1) << (id % 64);
+        }
+
+        // Calls fn(id) for every marked id in ascending order and clears the set
+        template <typename Fn>
+        void consume(Fn&& fn) {
+            for (size_t w = 0; w < mWords.size(); ++w) {
+                uint64_t bits = mWords[w];
+                while (bits) {
+                    fn(w * 64 + static_cast<size_t>(std::countr_zero(bits)));
+                    bits &= bits - 1;
+                }
+                mWords[w] = 0;
+            }
+        }
+
+    private:
+        std::vector<uint64_t> mWords;
+    };
+
+    struct FrameStamp {
+        uint32_t frame;
+    };
+}
+
+namespace realistic {
+namespace ecss_r {
+    using Reg = ecss::Registry<false>;
+
+    // Side bitset indexed by entity id, set by the writer, consumed by the reader
+    static void change_detection(benchmark::State& state) {
+        Reg reg;
+        const int n = state.range(0);
+        std::vector<ecss::EntityId> ids;
+        ids.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            reg.addComponent<Transform>(e, initialTransform(i));
+            ids.push_back(e);
+        }
+
+        DirtyBits dirty(static_cast<size_t>(n));
+        const size_t writes = writesPerFrame(state);
+        std::mt19937 rng(kDirtySeed);
+        double visited = 0.0;
+        for (auto _ : state) {
+            for (size_t i = 0; i < writes; ++i) {
+                const auto e = ids[rng() % ids.size()];
+                moveTransform(*reg.getComponent<Transform>(e));
+                dirty.mark(static_cast<size_t>(e));
+            }
+
+            float checksum = 0.f;
+            size_t seen = 0;
+            dirty.consume([&](size_t id) {
+                checksum += replicate(*reg.getComponent<Transform>(static_cast<ecss::EntityId>(id)));
+                ++seen;
+            });
+            visited += static_cast<double>(seen);
+            benchmark::DoNotOptimize(checksum);
+        }
+        reportDirty(state, writes, visited / static_cast<double>(std::max<benchmark::IterationCount>(1, state.iterations())));
+    }
+
+    // Baseline without tracking: a per-entity frame stamp and a reader that walks everything to find it
+    static void change_detection_full_scan(benchmark::State& state) {
+        Reg reg;
+        reg.registerArray<Transform, FrameStamp>();
+        const int n = state.range(0);
+        std::vector<ecss::EntityId> ids;
+        ids.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            reg.addComponent<Transform>(e, initialTransform(i));
+            reg.addComponent<FrameStamp>(e, FrameStamp{ 0 });
+            ids.push_back(e);
+        }
+
+        const size_t writes = writesPerFrame(state);
+        std::mt19937 rng(kDirtySeed);
+        auto view = reg.view<Transform, FrameStamp>();
+        uint32_t frame = 0;
+        for (auto _ : state) {
+            ++frame;
+            for (size_t i = 0; i < writes; ++i) {
+                const auto e = ids[rng() % ids.size()];
+                moveTransform(*reg.getComponent<Transform>(e));
+                reg.getComponent<FrameStamp>(e)->frame = frame;
+            }
+
+            float checksum = 0.f;
+            view.each([&](Transform& t, FrameStamp& stamp) {
+                if (stamp.frame == frame) {
+                    checksum += replicate(t);
+                }
+            });
+            benchmark::DoNotOptimize(checksum);
+        }
+        reportDirty(state, writes, static_cast<double>(n));
+    }
+} // namespace ecss_r
+
+namespace entt_r {
+    static void markDirty(entt::sparse_set& dirty, entt::registry&, entt::entity e) {
+        if (!dirty.contains(e)) {
+            dirty.push(e);
+        }
+    }
+
+    // on_update<Transform> listener collects patched entities into a sparse set
+    static void change_detection(benchmark::State& state) {
+        entt::registry reg;
+        const int n = state.range(0);
+        std::vector<entt::entity> ids(n);
+        reg.create(ids.begin(), ids.end());
+        for (int i = 0; i < n; ++i) {
+            reg.emplace<Transform>(ids[i], initialTransform(i));
+        }
+
+        entt::sparse_set dirty;
+        reg.on_update<Transform>().connect<&markDirty>(dirty);
+
+        const size_t writes = writesPerFrame(state);
+        std::mt19937 rng(kDirtySeed);
+        auto& transforms = reg.storage<Transform>();
+        double visited = 0.0;
+        for (auto _ : state) {
+            for (size_t i = 0; i < writes; ++i) {
+                reg.patch<Transform>(ids[rng() % ids.size()], moveTransform);
+            }
+
+            float checksum = 0.f;
+            for (auto e : dirty) {
+                checksum += replicate(transforms.get(e));
+            }
+            visited += static_cast<double>(dirty.size());
+            dirty.clear();
+            benchmark::DoNotOptimize(checksum);
+        }
+        reportDirty(state, writes, visited / static_cast<double>(std::max<benchmark::IterationCount>(1, state.iterations())));
+    }
+} // namespace entt_r
+
+namespace flecs_r {
+    // Cached query with detect_changes(): the reader skips tables whose Transform column did not change.
+    // Granularity is a table, so any write in the (single) table makes the reader walk all of it.
+    static void change_detection(benchmark::State& state) {
+        flecs::world world;
+        world.component<Transform>();
+        const int n = state.range(0);
+        std::vector<flecs::entity> ids;
+        ids.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            ids.push_back(world.entity().set<Transform>(initialTransform(i)));
+        }
+
+        auto reader = world.query_builder<const Transform>()
+            .cached()
+            .detect_changes()
+            .build();
+        reader.run([](flecs::iter& it) { while (it.next()) {} }); // sync change state
+
+        const size_t writes = writesPerFrame(state);
+        std::mt19937 rng(kDirtySeed);
+        double visited = 0.0;
+        for (auto _ : state) {
+            for (size_t i = 0; i < writes; ++i) {
+                auto e = ids[rng() % ids.size()];
+                moveTransform(*e.try_get_mut<Transform>());
+                e.modified<Transform>();
+            }
+
+            float checksum = 0.f;
+            size_t seen = 0;
+            if (reader.changed()) {
+                reader.run([&](flecs::iter& it) {
+                    while (it.next()) {
+                        if (!it.changed()) {
+                            continue;
+                        }
+                        auto t = it.field<const Transform>(0);
+                        for (auto row : it) {
+                            checksum += replicate(t[row]);
+                        }
+                        seen += it.count();
+                    }
+                });
+            }
+            visited += static_cast<double>(seen);
+            benchmark::DoNotOptimize(checksum);
+        }
+        reportDirty(state, writes, visited / static_cast<double>(std::max<benchmark::IterationCount>(1, state.iterations())));
+    }
+} // namespace flecs_r
+} // namespace realistic
+
+// realistic/<ecs>/change_detection[_full_scan]/<entities>/changed_permille:<1|10|100>
+#define BENCH_CHANGE_DETECTION_ONE(ECS, FUNC) \
+    BENCHMARK(memtrack::tracked<realistic::ECS::FUNC>)->Name("realistic/" #ECS "/" #FUNC) \
+        ->Unit(benchmark::TimeUnit::kMicrosecond)->ArgsProduct({{100000, 1000000}, {1, 10, 100}})->ArgNames({"", "changed_permille"})->MinTime(0.3);
+
+BENCH_CHANGE_DETECTION_ONE(ecss_r, change_detection)
+BENCH_CHANGE_DETECTION_ONE(ecss_r, change_detection_full_scan)
+BENCH_CHANGE_DETECTION_ONE(entt_r, change_detection)
+BENCH_CHANGE_DETECTION_ONE(flecs_r, change_detection)
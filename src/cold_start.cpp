@@ -0,0 +1,271 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <optional>
+
+#include "cache_tiers.h"
+#include "components.h"
+#include "registration.h"
+
+// One-time costs of short-lived worlds (match servers, level loads), cold vs warm:
+//  {cold,warm}_register/types:N    - construct a world and register N component types (Filler<k>) explicitly
+//                                    (ecss registerArray, EnTT storage<T>(), flecs component<T>())
+//  {cold,warm}_first_add/types:N   - construct a world and add N types to one entity, containers created lazily
+//  {cold,warm}_first_frame/<n>     - first view + first each() over Position + Velocity of an n-entity world
+// cold_* rows flush the data caches (cachetier::flushCaches) before every iteration, and cold_first_frame
+// also rebuilds the world, so each iteration sees a freshly loaded level. warm_* rows repeat the same work
+// with hot caches: warm_first_frame keeps its world, like the steady state of the frame loop.
+// Teardown and flushing run with the timer paused. Rows use a fixed iteration count because the
+// untimed flush dwarfs the timed region. For register/first_add, bytes_per_entity reads as per type.
+namespace {
+    constexpr size_t kMaxTypes = 64;
+    constexpr float kDt = 1.f / 60.f;
+
+    void step(Position& p, const Velocity& v) {
+        p.x += v.vx * kDt;
+        p.y += v.vy * kDt;
+        p.z += v.vz * kDt;
+    }
+
+    // Timer paused: drops the previous world, rebuilds it with setup() (if given), flushes for cold rows
+    template <bool Cold, typename World, typename Setup>
+    void prepare(benchmark::State& state, std::optional<World>& world, Setup&& setup) {
+        state.PauseTiming();
+        world.reset();
+        setup(world);
+        if constexpr (Cold) {
+            cachetier::flushCaches();
+        }
+        state.ResumeTiming();
+    }
+
+    template <typename World>
+    void teardown(benchmark::State& state, std::optional<World>& world) {
+        state.PauseTiming();
+        world.reset();
+        state.ResumeTiming();
+    }
+
+    // for k in [0, range(0)): fn.template operator()<Filler<k>>()
+    template <typename Fn>
+    void forEachType(const benchmark::State& state, Fn&& fn) {
+        const size_t types = static_cast<size_t>(state.range(0));
+        for (size_t k = 0; k < types; ++k) {
+            withFiller<kMaxTypes>(k, fn);
+        }
+    }
+
+    constexpr auto kNoSetup = [](auto&) {};
+}
+
+namespace realistic {
+namespace ecss_r {
+    using Reg = ecss::Registry<false>;
+
+    static void spawnMovers(Reg& reg, int n) {
+        reg.registerArray<Position, Velocity>();
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            reg.addComponent<Position>(e, Position{ (float)i, 0.f, 0.f });
+            reg.addComponent<Velocity>(e, Velocity{ 1.f, 1.f, 0.f });
+        }
+    }
+
+    template <bool Cold>
+    static void registerTypes(benchmark::State& state) {
+        std::optional<Reg> reg;
+        for (auto _ : state) {
+            prepare<Cold>(state, reg, kNoSetup);
+            reg.emplace();
+            forEachType(state, [&]<typename T>() { reg->registerArray<T>(); });
+            benchmark::ClobberMemory();
+        }
+        teardown(state, reg);
+    }
+
+    template <bool Cold>
+    static void firstAdd(benchmark::State& state) {
+        std::optional<Reg> reg;
+        for (auto _ : state) {
+            prepare<Cold>(state, reg, kNoSetup);
+            reg.emplace();
+            auto e = reg->takeEntity();
+            forEachType(state, [&]<typename T>() { reg->addComponent<T>(e, T{ 1.f }); });
+            benchmark::ClobberMemory();
+        }
+        teardown(state, reg);
+    }
+
+    template <bool Cold>
+    static void firstFrame(benchmark::State& state) {
+        const int n = state.range(0);
+        std::optional<Reg> reg;
+        if constexpr (!Cold) {
+            spawnMovers(reg.emplace(), n);
+        }
+        for (auto _ : state) {
+            if constexpr (Cold) {
+                prepare<Cold>(state, reg, [&](std::optional<Reg>& world) { spawnMovers(world.emplace(), n); });
+            }
+            reg->view<Position, Velocity>().each([](Position& p, Velocity& v) { step(p, v); });
+            benchmark::ClobberMemory();
+        }
+        teardown(state, reg);
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void cold_register(benchmark::State& state) { registerTypes<true>(state); }
+    static void warm_register(benchmark::State& state) { registerTypes<false>(state); }
+    static void cold_first_add(benchmark::State& state) { firstAdd<true>(state); }
+    static void warm_first_add(benchmark::State& state) { firstAdd<false>(state); }
+    static void cold_first_frame(benchmark::State& state) { firstFrame<true>(state); }
+    static void warm_first_frame(benchmark::State& state) { firstFrame<false>(state); }
+} // namespace ecss_r
+
+namespace entt_r {
+    static void spawnMovers(entt::registry& reg, int n) {
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.create();
+            reg.emplace<Position>(e, Position{ (float)i, 0.f, 0.f });
+            reg.emplace<Velocity>(e, Velocity{ 1.f, 1.f, 0.f });
+        }
+    }
+
+    template <bool Cold>
+    static void registerTypes(benchmark::State& state) {
+        std::optional<entt::registry> reg;
+        for (auto _ : state) {
+            prepare<Cold>(state, reg, kNoSetup);
+            reg.emplace();
+            forEachType(state, [&]<typename T>() { reg->storage<T>(); });
+            benchmark::ClobberMemory();
+        }
+        teardown(state, reg);
+    }
+
+    template <bool Cold>
+    static void firstAdd(benchmark::State& state) {
+        std::optional<entt::registry> reg;
+        for (auto _ : state) {
+            prepare<Cold>(state, reg, kNoSetup);
+            reg.emplace();
+            auto e = reg->create();
+            forEachType(state, [&]<typename T>() { reg->emplace<T>(e, T{ 1.f }); });
+            benchmark::ClobberMemory();
+        }
+        teardown(state, reg);
+    }
+
+    template <bool Cold>
+    static void firstFrame(benchmark::State& state) {
+        const int n = state.range(0);
+        std::optional<entt::registry> reg;
+        if constexpr (!Cold) {
+            spawnMovers(reg.emplace(), n);
+        }
+        for (auto _ : state) {
+            if constexpr (Cold) {
+                prepare<Cold>(state, reg, [&](std::optional<entt::registry>& world) { spawnMovers(world.emplace(), n); });
+            }
+            reg->view<Position, const Velocity>().each([](Position& p, const Velocity& v) { step(p, v); });
+            benchmark::ClobberMemory();
+        }
+        teardown(state, reg);
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void cold_register(benchmark::State& state) { registerTypes<true>(state); }
+    static void warm_register(benchmark::State& state) { registerTypes<false>(state); }
+    static void cold_first_add(benchmark::State& state) { firstAdd<true>(state); }
+    static void warm_first_add(benchmark::State& state) { firstAdd<false>(state); }
+    static void cold_first_frame(benchmark::State& state) { firstFrame<true>(state); }
+    static void warm_first_frame(benchmark::State& state) { firstFrame<false>(state); }
+} // namespace entt_r
+
+namespace flecs_r {
+    static void spawnMovers(flecs::world& world, int n) {
+        world.component<Position>();
+        world.component<Velocity>();
+        for (int i = 0; i < n; ++i) {
+            world.entity().set<Position>({ (float)i, 0.f, 0.f }).set<Velocity>({ 1.f, 1.f, 0.f });
+        }
+    }
+
+    // world construction includes flecs' builtin modules
+    template <bool Cold>
+    static void registerTypes(benchmark::State& state) {
+        std::optional<flecs::world> world;
+        for (auto _ : state) {
+            prepare<Cold>(state, world, kNoSetup);
+            world.emplace();
+            forEachType(state, [&]<typename T>() { world->component<T>(); });
+            benchmark::ClobberMemory();
+        }
+        teardown(state, world);
+    }
+
+    template <bool Cold>
+    static void firstAdd(benchmark::State& state) {
+        std::optional<flecs::world> world;
+        for (auto _ : state) {
+            prepare<Cold>(state, world, kNoSetup);
+            world.emplace();
+            auto e = world->entity();
+            forEachType(state, [&]<typename T>() { e.set<T>(T{ 1.f }); });
+            benchmark::ClobberMemory();
+        }
+        teardown(state, world);
+    }
+
+    // The query is created, run and destructed every iteration, cold or warm
+    template <bool Cold>
+    static void firstFrame(benchmark::State& state) {
+        const int n = state.range(0);
+        std::optional<flecs::world> world;
+        if constexpr (!Cold) {
+            spawnMovers(world.emplace(), n);
+        }
+        for (auto _ : state) {
+            if constexpr (Cold) {
+                prepare<Cold>(state, world, [&](std::optional<flecs::world>& w) { spawnMovers(w.emplace(), n); });
+            }
+            auto q = world->query<Position, const Velocity>();
+            q.each([](Position& p, const Velocity& v) { step(p, v); });
+            q.destruct();
+            benchmark::ClobberMemory();
+        }
+        teardown(state, world);
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void cold_register(benchmark::State& state) { registerTypes<true>(state); }
+    static void warm_register(benchmark::State& state) { registerTypes<false>(state); }
+    static void cold_first_add(benchmark::State& state) { firstAdd<true>(state); }
+    static void warm_first_add(benchmark::State& state) { firstAdd<false>(state); }
+    static void cold_first_frame(benchmark::State& state) { firstFrame<true>(state); }
+    static void warm_first_frame(benchmark::State& state) { firstFrame<false>(state); }
+} // namespace flecs_r
+} // namespace realistic
+
+// realistic/<ecs>/{cold,warm}_{register,first_add}/types:<N> and realistic/<ecs>/{cold,warm}_first_frame/<entities>
+#define BENCH_COLD_START_TYPES_ONE(ECS, FUNC) \
+    BENCHMARK(memtrack::tracked<realistic::ECS::FUNC>)->Name("realistic/" #ECS "/" #FUNC) \
+        ->Unit(benchmark::TimeUnit::kMicrosecond)->ArgName("types")->Arg(1)->Arg(16)->Arg(64)->Iterations(50);
+
+#define BENCH_COLD_START_FRAME_ONE(ECS, FUNC) \
+    BENCHMARK(memtrack::tracked<realistic::ECS::FUNC>)->Name("realistic/" #ECS "/" #FUNC) \
+        ->Unit(benchmark::TimeUnit::kMicrosecond)->Arg(10000)->Arg(100000)->Iterations(50);
+
+#define REGISTER_COLD_START(ECS) \
+    BENCH_COLD_START_TYPES_ONE(ECS, cold_register) \
+    BENCH_COLD_START_TYPES_ONE(ECS, warm_register) \
+    BENCH_COLD_START_TYPES_ONE(ECS, cold_first_add) \
+    BENCH_COLD_START_TYPES_ONE(ECS, warm_first_add) \
+    BENCH_COLD_START_FRAME_ONE(ECS, cold_first_frame) \
+    BENCH_COLD_START_FRAME_ONE(ECS, warm_first_frame)
+
+REGISTER_COLD_START(ecss_r)
+REGISTER_COLD_START(entt_r)
+REGISTER_COLD_START(flecs_r)
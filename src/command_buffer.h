@@ -0,0 +1,134 @@
+#pragma once
+
+#include <ecss/Registry.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Deferred structural changes for ECSS.
+// ECSS has no command buffer of its own, so systems record add/remove/destroy here while iterating
+// and replay them at a sync point with apply(). Commands are replayed per component type, sorted by
+// entity id, so each type's sectors are walked front to back once; destroys go last as a single
+// destroyEntities() call. An entity that is both modified and destroyed in one buffer ends up destroyed.
+namespace cmd {
+    template <bool ThreadSafe>
+    class CommandBuffer {
+    public:
+        using Reg = ecss::Registry<ThreadSafe>;
+        using EntityId = ecss::EntityId;
+
+        template <typename T>
+        void add(EntityId entity, T component) {
+            queue<AddQueue<T>>(mAdds).commands.emplace_back(entity, std::move(component));
+            ++mRecorded;
+        }
+
+        template <typename T>
+        void remove(EntityId entity) {
+            queue<RemoveQueue<T>>(mRemoves).entities.push_back(entity);
+            ++mRecorded;
+        }
+
+        void destroy(EntityId entity) {
+            mDestroys.push_back(entity);
+            ++mRecorded;
+        }
+
+        // Number of commands recorded since the last apply()/clear()
+        size_t size() const { return mRecorded; }
+        bool empty() const { return mRecorded == 0; }
+
+        // Replays removes, then adds, then destroys. Queue storage is kept for the next frame.
+        void apply(Reg& reg) {
+            for (auto& q : mRemoves) {
+                if (q) q->apply(reg);
+            }
+            for (auto& q : mAdds) {
+                if (q) q->apply(reg);
+            }
+            if (!mDestroys.empty()) {
+                std::sort(mDestroys.begin(), mDestroys.end());
+                mDestroys.erase(std::unique(mDestroys.begin(), mDestroys.end()), mDestroys.end());
+                reg.destroyEntities(mDestroys);
+            }
+            clear();
+        }
+
+        void clear() {
+            for (auto& q : mRemoves) {
+                if (q) q->clear();
+            }
+            for (auto& q : mAdds) {
+                if (q) q->clear();
+            }
+            mDestroys.clear();
+            mRecorded = 0;
+        }
+
+    private:
+        struct QueueBase {
+            virtual ~QueueBase() = default;
+            virtual void apply(Reg& reg) = 0;
+            virtual void clear() = 0;
+        };
+
+        template <typename T>
+        struct AddQueue final : QueueBase {
+            std::vector<std::pair<EntityId, T>> commands;
+
+            void apply(Reg& reg) override {
+                // stable: the last add recorded for an entity wins, as with immediate calls
+                std::stable_sort(commands.begin(), commands.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+                for (auto& [entity, component] : commands) {
+                    reg.template addComponent<T>(entity, std::move(component));
+                }
+            }
+            void clear() override { commands.clear(); }
+        };
+
+        template <typename T>
+        struct RemoveQueue final : QueueBase {
+            std::vector<EntityId> entities;
+
+            void apply(Reg& reg) override {
+                std::sort(entities.begin(), entities.end());
+                entities.erase(std::unique(entities.begin(), entities.end()), entities.end());
+                for (auto entity : entities) {
+                    reg.template destroyComponent<T>(entity);
+                }
+            }
+            void clear() override { entities.clear(); }
+        };
+
+        static size_t nextTypeIndex() {
+            static size_t counter = 0;
+            return counter++;
+        }
+
+        template <typename Q>
+        static size_t typeIndex() {
+            static const size_t index = nextTypeIndex();
+            return index;
+        }
+
+        template <typename Q>
+        static Q& queue(std::vector<std::unique_ptr<QueueBase>>& queues) {
+            const size_t index = typeIndex<Q>();
+            if (index >= queues.size()) {
+                queues.resize(index + 1);
+            }
+            if (!queues[index]) {
+                queues[index] = std::make_unique<Q>();
+            }
+            return static_cast<Q&>(*queues[index]);
+        }
+
+        std::vector<std::unique_ptr<QueueBase>> mAdds;
+        std::vector<std::unique_ptr<QueueBase>> mRemoves;
+        std::vector<EntityId> mDestroys;
+        size_t mRecorded = 0;
+    };
+}
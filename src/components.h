@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// Components shared by every benchmark executable
+
+struct Position { float x, y, z; };
+struct Velocity { float vx, vy, vz; };
+
+// Additional components for realistic scenarios
+struct Transform {
+    float x, y, z;           // position
+    float rx, ry, rz, rw;    // rotation quaternion
+    float sx, sy, sz;        // scale
+};
+
+struct RigidBody {
+    float vx, vy, vz;        // velocity
+    float ax, ay, az;        // acceleration
+    float mass;
+    float drag;
+};
+
+struct Health {
+    float current;
+    float max;
+    float regen;
+    bool isDead;
+};
+
+struct Damage {
+    float amount;
+    float armor;
+    float critChance;
+    float critMultiplier;
+};
+
+struct AIState {
+    int state;               // 0=idle, 1=patrol, 2=chase, 3=attack
+    float timer;
+    float aggroRange;
+    float attackRange;
+    uint32_t targetEntity;
+};
+
+struct Sprite {
+    uint32_t textureId;
+    float u0, v0, u1, v1;    // UV coords
+    uint32_t color;
+    int layer;
+};
+
+struct ParticleEmitter {
+    float emitRate;
+    float lifetime;
+    float timer;
+    int maxParticles;
+    int activeParticles;
+};
+
+struct AABB {
+    float minX, minY, minZ;
+    float maxX, maxY, maxZ;
+};
+
+// Column-major 4x4, world = parent world * local TRS
+struct WorldMatrix {
+    float m[16];
+};
+
+struct Tag_Player {};
+struct Tag_Enemy {};
+struct Tag_Projectile {};
+struct Tag_Static {};
+
+// Fixed-size payload for migration-cost sweeps (Payload<12> has the size of Position)
+template <size_t Bytes>
+struct Payload {
+    static_assert(Bytes % sizeof(float) == 0, "Payload size must be a multiple of 4 bytes");
+    float data[Bytes / sizeof(float)];
+};
+
+// Distinct component types for world-size sweeps (Filler<0>, Filler<1>, ...)
+template <size_t Index>
+struct Filler {
+    float value;
+};
+
+namespace filler_detail {
+    template <typename Fn, size_t... I>
+    void dispatch(size_t type, Fn& fn, std::index_sequence<I...>) {
+        (void)((type == I ? (fn.template operator()<Filler<I>>(), true) : false) || ...);
+    }
+
+    template <typename Op, size_t... I>
+    constexpr auto table(std::index_sequence<I...>) {
+        return std::array{ &Op::template apply<Filler<I>>... };
+    }
+}
+
+// Calls fn.template operator()<Filler<type>>() for a runtime type index < Count
+template <size_t Count, typename Fn>
+void withFiller(size_t type, Fn&& fn) {
+    filler_detail::dispatch(type, fn, std::make_index_sequence<Count>{});
+}
+
+// Op::apply<Filler<I>> for I in [0, Count), indexed by I - constant-time dispatch for hot loops
+template <typename Op, size_t Count>
+constexpr auto fillerTable() {
+    return filler_detail::table<Op>(std::make_index_sequence<Count>{});
+}
@@ -0,0 +1,203 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "components.h"
+#include "perf_counters.h"
+#include "registration.h"
+
+// Iteration after churn: K = range(1) frames of 10% churn (random victims destroyed, as many spawned),
+// then the timed loop is a plain Position + Velocity sweep over the range(0) survivors.
+// Counters describe the storage the sweep walks:
+//  slots      - Position slots spanned (live + dead)
+//  dead_ratio - 1 - live / slots
+namespace {
+    constexpr uint32_t kChurnSeed = 0xF4A6;
+
+    void reportSlots(benchmark::State& state, int64_t live, int64_t slots) {
+        state.counters["slots"] = static_cast<double>(slots);
+        state.counters["dead_ratio"] = slots > 0 ? 1.0 - static_cast<double>(live) / static_cast<double>(slots) : 0.0;
+        state.SetItemsProcessed(state.iterations() * live);
+    }
+
+    // Runs `frames` churn frames over `entities`; destroy(batch) and spawn(frame, j) are backend specific
+    template <typename Id, typename Destroy, typename Spawn>
+    void churnFrames(std::vector<Id>& entities, int64_t frames, Destroy&& destroy, Spawn&& spawn) {
+        std::mt19937 rng(kChurnSeed);
+        const size_t churnRate = entities.size() / 10;
+        std::vector<Id> victims;
+        victims.reserve(churnRate);
+        for (int64_t frame = 0; frame < frames; ++frame) {
+            victims.clear();
+            for (size_t j = 0; j < churnRate; ++j) {
+                const size_t pick = std::uniform_int_distribution<size_t>(0, entities.size() - 1)(rng);
+                victims.push_back(entities[pick]);
+                entities[pick] = entities.back();
+                entities.pop_back();
+            }
+            destroy(victims);
+            for (size_t j = 0; j < churnRate; ++j) {
+                entities.push_back(spawn(frame, j));
+            }
+        }
+    }
+}
+
+namespace realistic {
+namespace ecss_r {
+    using Reg = ecss::Registry<false>;
+
+    template <bool Defragment>
+    static void churned_iteration_impl(benchmark::State& state) {
+        Reg reg;
+        reg.registerArray<Position, Velocity>();
+        const int n = state.range(0);
+
+        std::vector<ecss::EntityId> entities;
+        entities.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            reg.addComponent<Position>(e, Position{ (float)i, 0.f, 0.f });
+            reg.addComponent<Velocity>(e, Velocity{ 1.f, 0.f, 0.f });
+            entities.push_back(e);
+        }
+        churnFrames(entities, state.range(1),
+            [&](std::vector<ecss::EntityId>& victims) { reg.destroyEntities(victims); },
+            [&](int64_t frame, size_t j) {
+                auto e = reg.takeEntity();
+                reg.addComponent<Position>(e, Position{ (float)frame, (float)j, 0.f });
+                reg.addComponent<Velocity>(e, Velocity{ 1.f, 0.f, 0.f });
+                return e;
+            });
+
+        if constexpr (Defragment) {
+            const auto start = std::chrono::steady_clock::now();
+            reg.defragment();
+            state.counters["defragment_us"] = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        // Slot span: the highest linear index any survivor occupies
+        auto* container = reg.getComponentContainer<Position>();
+        int64_t slots = 0;
+        for (auto e : entities) {
+            const auto idx = container->template findLinearIdx<false>(e);
+            if (idx != ecss::INVALID_IDX) {
+                slots = std::max<int64_t>(slots, static_cast<int64_t>(idx) + 1);
+            }
+        }
+
+        auto view = reg.view<Position, Velocity>();
+        PERF_ENTITY_COUNTERS(state, n);
+        for (auto _ : state) {
+            float accum = 0.f;
+            view.each([&](Position& p, Velocity& v) { accum += p.x + v.vx; });
+            benchmark::DoNotOptimize(accum);
+        }
+        reportSlots(state, n, slots);
+    }
+
+    static void churned_iteration(benchmark::State& state) {
+        churned_iteration_impl<false>(state);
+    }
+
+    // Same world compacted with defragment() before the sweep; defragment_us is its one-off cost
+    static void churned_iteration_defragmented(benchmark::State& state) {
+        churned_iteration_impl<true>(state);
+    }
+} // namespace ecss_r
+
+namespace entt_r {
+    static void churned_iteration(benchmark::State& state) {
+        entt::registry reg;
+        const int n = state.range(0);
+
+        std::vector<entt::entity> entities;
+        entities.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.create();
+            reg.emplace<Position>(e, Position{ (float)i, 0.f, 0.f });
+            reg.emplace<Velocity>(e, Velocity{ 1.f, 0.f, 0.f });
+            entities.push_back(e);
+        }
+        churnFrames(entities, state.range(1),
+            [&](std::vector<entt::entity>& victims) { reg.destroy(victims.begin(), victims.end()); },
+            [&](int64_t frame, size_t j) {
+                auto e = reg.create();
+                reg.emplace<Position>(e, Position{ (float)frame, (float)j, 0.f });
+                reg.emplace<Velocity>(e, Velocity{ 1.f, 0.f, 0.f });
+                return e;
+            });
+
+        // swap-and-pop storage: always packed, slots == live
+        const auto slots = static_cast<int64_t>(reg.storage<Position>().size());
+
+        auto view = reg.view<Position, Velocity>();
+        PERF_ENTITY_COUNTERS(state, n);
+        for (auto _ : state) {
+            float accum = 0.f;
+            view.each([&](Position& p, Velocity& v) { accum += p.x + v.vx; });
+            benchmark::DoNotOptimize(accum);
+        }
+        reportSlots(state, n, slots);
+    }
+} // namespace entt_r
+
+namespace flecs_r {
+    static void churned_iteration(benchmark::State& state) {
+        flecs::world world;
+        world.component<Position>();
+        world.component<Velocity>();
+        const int n = state.range(0);
+
+        std::vector<flecs::entity> entities;
+        entities.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            entities.push_back(world.entity()
+                .set<Position>({ (float)i, 0.f, 0.f })
+                .set<Velocity>({ 1.f, 0.f, 0.f }));
+        }
+        churnFrames(entities, state.range(1),
+            [&](std::vector<flecs::entity>& victims) {
+                world.defer_begin();
+                for (auto e : victims) {
+                    e.destruct();
+                }
+                world.defer_end();
+            },
+            [&](int64_t frame, size_t j) {
+                return world.entity()
+                    .set<Position>({ (float)frame, (float)j, 0.f })
+                    .set<Velocity>({ 1.f, 0.f, 0.f });
+            });
+
+        // tables are packed on delete, slots == matched rows
+        auto q = world.query<Position, Velocity>();
+        const auto slots = static_cast<int64_t>(q.count());
+
+        PERF_ENTITY_COUNTERS(state, n);
+        for (auto _ : state) {
+            float accum = 0.f;
+            q.each([&](Position& p, Velocity& v) { accum += p.x + v.vx; });
+            benchmark::DoNotOptimize(accum);
+        }
+        reportSlots(state, n, slots);
+    }
+} // namespace flecs_r
+} // namespace realistic
+
+// realistic/<ecs>/churned_iteration[_defragmented]/<entities>/churn_frames:<K>
+#define BENCH_FRAGMENTATION_ONE(ECS, FUNC) \
+    BENCHMARK(memtrack::tracked<realistic::ECS::FUNC>)->Name("realistic/" #ECS "/" #FUNC) \
+        ->Unit(benchmark::TimeUnit::kMicrosecond)->ArgsProduct({{10000, 100000}, {0, 100, 1000}})->ArgNames({"", "churn_frames"})->MinTime(0.3);
+
+BENCH_FRAGMENTATION_ONE(ecss_r, churned_iteration)
+BENCH_FRAGMENTATION_ONE(ecss_r, churned_iteration_defragmented)
+BENCH_FRAGMENTATION_ONE(entt_r, churned_iteration)
+BENCH_FRAGMENTATION_ONE(flecs_r, churned_iteration)
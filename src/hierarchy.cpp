@@ -0,0 +1,218 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "components.h"
+#include "registration.h"
+
+// Scene-graph propagation: range(0) Transform nodes in a forest of depth range(1), every frame
+// WorldMatrix = parent WorldMatrix * local TRS from the roots down to the leaves.
+// Each level holds n / depth nodes, each non-root node hangs off a random node of the level above.
+// Entities are spawned in a shuffled order (streamed-in level chunks), so parents are not guaranteed
+// to precede their children in storage - every backend has to obtain that order itself.
+namespace {
+    constexpr uint32_t kNoParent = UINT32_MAX;
+    constexpr uint32_t kForestSeed = 0x7EE5;
+
+    struct Forest {
+        std::vector<uint32_t> parent;      // per node, kNoParent for roots; nodes are numbered level by level
+        std::vector<uint32_t> depth;       // per node
+        std::vector<uint32_t> levelStart;  // first node of each level, plus the end
+        std::vector<uint32_t> spawnOrder;  // permutation of the nodes
+    };
+
+    Forest buildForest(uint32_t n, uint32_t depth) {
+        Forest f;
+        std::mt19937 rng(kForestSeed);
+        const uint32_t perLevel = std::max(1u, n / depth);
+        f.parent.resize(n);
+        f.depth.resize(n);
+        for (uint32_t node = 0; node < n; ++node) {
+            const uint32_t level = std::min(node / perLevel, depth - 1);
+            if (f.levelStart.size() <= level) {
+                f.levelStart.push_back(node);
+            }
+            f.depth[node] = level;
+            if (level == 0) {
+                f.parent[node] = kNoParent;
+            } else {
+                const uint32_t above = f.levelStart[level - 1];
+                f.parent[node] = above + std::uniform_int_distribution<uint32_t>(0, f.levelStart[level] - above - 1)(rng);
+            }
+        }
+        f.levelStart.push_back(n);
+        f.spawnOrder.resize(n);
+        std::iota(f.spawnOrder.begin(), f.spawnOrder.end(), 0u);
+        std::shuffle(f.spawnOrder.begin(), f.spawnOrder.end(), rng);
+        return f;
+    }
+
+    Transform nodeTransform(uint32_t node) {
+        const float angle = static_cast<float>(node % 360) * 0.0174533f * 0.5f;
+        return Transform{
+            (float)(node % 7), 1.f, (float)(node % 3),
+            0.f, std::sin(angle), 0.f, std::cos(angle),  // yaw
+            1.f, 1.f, 1.f
+        };
+    }
+
+    WorldMatrix localMatrix(const Transform& t) {
+        const float xx = t.rx * t.rx, yy = t.ry * t.ry, zz = t.rz * t.rz;
+        const float xy = t.rx * t.ry, xz = t.rx * t.rz, yz = t.ry * t.rz;
+        const float wx = t.rw * t.rx, wy = t.rw * t.ry, wz = t.rw * t.rz;
+        return WorldMatrix{ {
+            (1.f - 2.f * (yy + zz)) * t.sx, 2.f * (xy + wz) * t.sx, 2.f * (xz - wy) * t.sx, 0.f,
+            2.f * (xy - wz) * t.sy, (1.f - 2.f * (xx + zz)) * t.sy, 2.f * (yz + wx) * t.sy, 0.f,
+            2.f * (xz + wy) * t.sz, 2.f * (yz - wx) * t.sz, (1.f - 2.f * (xx + yy)) * t.sz, 0.f,
+            t.x, t.y, t.z, 1.f
+        } };
+    }
+
+    WorldMatrix multiply(const WorldMatrix& a, const WorldMatrix& b) {
+        WorldMatrix r;
+        for (int col = 0; col < 4; ++col) {
+            for (int row = 0; row < 4; ++row) {
+                r.m[col * 4 + row] = a.m[row] * b.m[col * 4] + a.m[4 + row] * b.m[col * 4 + 1]
+                    + a.m[8 + row] * b.m[col * 4 + 2] + a.m[12 + row] * b.m[col * 4 + 3];
+            }
+        }
+        return r;
+    }
+
+    template <typename Id>
+    struct ParentOf {
+        Id entity;
+        uint32_t depth;
+    };
+}
+
+namespace realistic {
+namespace ecss_r {
+    using Reg = ecss::Registry<false>;
+
+    // Parent component + lookups: no relationship-aware order, so the nodes are walked level by level
+    // from a side list and parent matrices are fetched with getComponent
+    static void hierarchy_transform_propagation(benchmark::State& state) {
+        Reg reg;
+        reg.registerArray<Transform, ParentOf<ecss::EntityId>, WorldMatrix>();
+        const auto forest = buildForest(static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(1)));
+        const auto n = forest.parent.size();
+
+        std::vector<ecss::EntityId> ids(n);
+        for (auto node : forest.spawnOrder) {
+            ids[node] = reg.takeEntity();
+        }
+        for (auto node : forest.spawnOrder) {
+            reg.addComponent<Transform>(ids[node], nodeTransform(node));
+            reg.addComponent<WorldMatrix>(ids[node], WorldMatrix{});
+            if (forest.parent[node] != kNoParent) {
+                reg.addComponent<ParentOf<ecss::EntityId>>(ids[node], ParentOf<ecss::EntityId>{ ids[forest.parent[node]], forest.depth[node] });
+            }
+        }
+
+        std::vector<ecss::EntityId> roots(ids.begin(), ids.begin() + forest.levelStart[1]);
+        std::vector<ecss::EntityId> children(ids.begin() + forest.levelStart[1], ids.end()); // level by level
+
+        for (auto _ : state) {
+            for (auto e : roots) {
+                *reg.getComponent<WorldMatrix>(e) = localMatrix(*reg.getComponent<Transform>(e));
+            }
+            for (auto e : children) {
+                const auto parent = reg.getComponent<ParentOf<ecss::EntityId>>(e)->entity;
+                *reg.getComponent<WorldMatrix>(e) = multiply(*reg.getComponent<WorldMatrix>(parent), localMatrix(*reg.getComponent<Transform>(e)));
+            }
+            benchmark::DoNotOptimize(reg.getComponent<WorldMatrix>(children.back())->m[12]);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+} // namespace ecss_r
+
+namespace entt_r {
+    // Ordered storage: ParentOf sorted by depth once, Transform/WorldMatrix sorted to match, then one
+    // linear pass over the ParentOf pool (roots carry entt::null)
+    static void hierarchy_transform_propagation(benchmark::State& state) {
+        entt::registry reg;
+        const auto forest = buildForest(static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(1)));
+        const auto n = forest.parent.size();
+
+        std::vector<entt::entity> ids(n);
+        for (auto node : forest.spawnOrder) {
+            ids[node] = reg.create();
+        }
+        for (auto node : forest.spawnOrder) {
+            reg.emplace<Transform>(ids[node], nodeTransform(node));
+            reg.emplace<WorldMatrix>(ids[node], WorldMatrix{});
+            const auto parent = forest.parent[node] != kNoParent ? ids[forest.parent[node]] : entt::entity{ entt::null };
+            reg.emplace<ParentOf<entt::entity>>(ids[node], ParentOf<entt::entity>{ parent, forest.depth[node] });
+        }
+
+        reg.sort<ParentOf<entt::entity>>([](const auto& lhs, const auto& rhs) { return lhs.depth < rhs.depth; });
+        reg.sort<Transform, ParentOf<entt::entity>>();
+        reg.sort<WorldMatrix, ParentOf<entt::entity>>();
+
+        auto& parents = reg.storage<ParentOf<entt::entity>>();
+        auto& transforms = reg.storage<Transform>();
+        auto& worlds = reg.storage<WorldMatrix>();
+        for (auto _ : state) {
+            for (auto [e, parent] : parents.each()) {
+                const auto local = localMatrix(transforms.get(e));
+                worlds.get(e) = parent.entity == entt::null ? local : multiply(worlds.get(parent.entity), local);
+            }
+            benchmark::DoNotOptimize(worlds.get(ids.back()).m[12]);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+} // namespace entt_r
+
+namespace flecs_r {
+    // Native ChildOf pairs; the cascade term visits tables breadth-first and hands in the parent's matrix
+    static void hierarchy_transform_propagation(benchmark::State& state) {
+        flecs::world world;
+        world.component<Transform>();
+        world.component<WorldMatrix>();
+        const auto forest = buildForest(static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(1)));
+        const auto n = forest.parent.size();
+
+        std::vector<flecs::entity> ids(n);
+        for (auto node : forest.spawnOrder) {
+            ids[node] = world.entity();
+        }
+        for (auto node : forest.spawnOrder) {
+            ids[node].set<Transform>(nodeTransform(node)).set<WorldMatrix>(WorldMatrix{});
+            if (forest.parent[node] != kNoParent) {
+                ids[node].child_of(ids[forest.parent[node]]);
+            }
+        }
+
+        auto q = world.query_builder<const Transform, WorldMatrix, const WorldMatrix*>()
+            .term_at(2).parent().cascade()
+            .build();
+
+        for (auto _ : state) {
+            q.each([](const Transform& t, WorldMatrix& out, const WorldMatrix* parent) {
+                const auto local = localMatrix(t);
+                out = parent ? multiply(*parent, local) : local;
+            });
+            benchmark::DoNotOptimize(ids.back().try_get<WorldMatrix>()->m[12]);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+} // namespace flecs_r
+} // namespace realistic
+
+// realistic/<ecs>/hierarchy_transform_propagation/<nodes>/depth:<levels>
+#define BENCH_HIERARCHY_ONE(ECS) \
+    BENCHMARK(memtrack::tracked<realistic::ECS::hierarchy_transform_propagation>)->Name("realistic/" #ECS "/hierarchy_transform_propagation") \
+        ->Unit(benchmark::TimeUnit::kMicrosecond)->ArgsProduct({{1000, 100000, 1000000}, {4, 16}})->ArgNames({"", "depth"})->MinTime(0.3);
+
+BENCH_HIERARCHY_ONE(ecss_r)
+BENCH_HIERARCHY_ONE(entt_r)
+BENCH_HIERARCHY_ONE(flecs_r)
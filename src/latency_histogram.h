@@ -0,0 +1,180 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+// Per-frame latency distribution for the realistic scenarios.
+// A scenario opts in by iterating latency::Frames instead of the State itself:
+//     for (auto _ : latency::Frames(state)) { ... }
+// Run normally, the adaptor is a passthrough. Run through latency::perFrame<F> (registered with
+// UseManualTime), every frame is timed on its own, fed to SetIterationTime and recorded in an
+// HDR-style histogram whose percentiles end up in the counters:
+//  p50_us / p99_us / p999_us - frame time at that percentile (bucket upper bound, < 0.8% above the sample)
+//  max_us                    - slowest frame
+namespace latency {
+    // Log-linear buckets over nanoseconds: exact below 256 ns, then 128 linear steps per power of two
+    class Histogram {
+    public:
+        static constexpr unsigned kSubBucketBits = 8;
+        static constexpr uint64_t kSubBuckets = uint64_t{1} << kSubBucketBits;
+        static constexpr uint64_t kHalfBuckets = kSubBuckets / 2;
+        static constexpr size_t kBuckets = kSubBuckets + (64 - kSubBucketBits) * kHalfBuckets;
+
+        void record(uint64_t ns) {
+            ++mCounts[index(ns)];
+            ++mTotal;
+            mMax = std::max(mMax, ns);
+        }
+
+        // Smallest bucket bound that at least `quantile` of the samples fall under, clamped to the max
+        uint64_t percentile(double quantile) const {
+            if (mTotal == 0) {
+                return 0;
+            }
+            const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(quantile * static_cast<double>(mTotal))));
+            uint64_t seen = 0;
+            for (size_t i = 0; i < kBuckets; ++i) {
+                seen += mCounts[i];
+                if (seen >= rank) {
+                    return std::min(upperBound(i), mMax);
+                }
+            }
+            return mMax;
+        }
+
+        uint64_t max() const { return mMax; }
+        uint64_t count() const { return mTotal; }
+
+    private:
+        static size_t index(uint64_t ns) {
+            if (ns < kSubBuckets) {
+                return static_cast<size_t>(ns);
+            }
+            // shift keeps the top kSubBucketBits bits: sub is in [kHalfBuckets, kSubBuckets)
+            const unsigned shift = static_cast<unsigned>(std::bit_width(ns)) - kSubBucketBits;
+            const uint64_t sub = ns >> shift;
+            return static_cast<size_t>(kSubBuckets + (shift - 1) * kHalfBuckets + (sub - kHalfBuckets));
+        }
+
+        static uint64_t upperBound(size_t bucket) {
+            if (bucket < kSubBuckets) {
+                return bucket;
+            }
+            const uint64_t offset = bucket - kSubBuckets;
+            const unsigned shift = static_cast<unsigned>(offset / kHalfBuckets) + 1;
+            const uint64_t sub = offset % kHalfBuckets + kHalfBuckets;
+            return ((sub + 1) << shift) - 1;
+        }
+
+        std::array<uint64_t, kBuckets> mCounts{};
+        uint64_t mTotal = 0;
+        uint64_t mMax = 0;
+    };
+
+    // Histogram of the benchmark currently run through perFrame (benchmarks run one at a time)
+    inline Histogram*& activeHistogram() {
+        static Histogram* histogram = nullptr;
+        return histogram;
+    }
+
+    // Range-for adaptor over benchmark::State. Use pauseTiming()/resumeTiming() instead of the State's
+    // so untimed work inside a frame stays out of the frame time as well.
+    class Frames {
+        using Clock = std::chrono::steady_clock;
+        using Inner = decltype(std::declval<benchmark::State&>().begin());
+
+    public:
+        explicit Frames(benchmark::State& state) : mState(state), mHistogram(activeHistogram()) {}
+
+        Frames(const Frames&) = delete;
+        Frames& operator=(const Frames&) = delete;
+
+        class Iterator {
+        public:
+            Iterator(Inner inner, Frames* frames) : mInner(inner), mFrames(frames) {}
+
+            auto operator*() const { return *mInner; }
+
+            Iterator& operator++() {
+                mFrames->endFrame();
+                ++mInner;
+                return *this;
+            }
+
+            // Called once before every frame: the frame clock starts here
+            bool operator!=(const Iterator& end) {
+                if (!(mInner != end.mInner)) {
+                    return false;
+                }
+                mFrames->beginFrame();
+                return true;
+            }
+
+        private:
+            Inner mInner;
+            Frames* mFrames;
+        };
+
+        Iterator begin() { return Iterator(mState.begin(), this); }
+        Iterator end() { return Iterator(mState.end(), this); }
+
+        void pauseTiming() {
+            mState.PauseTiming();
+            if (mHistogram) {
+                mPauseStart = Clock::now();
+            }
+        }
+
+        void resumeTiming() {
+            if (mHistogram) {
+                mPaused += Clock::now() - mPauseStart;
+            }
+            mState.ResumeTiming();
+        }
+
+    private:
+        void beginFrame() {
+            if (mHistogram) {
+                mPaused = Clock::duration::zero();
+                mFrameStart = Clock::now();
+            }
+        }
+
+        void endFrame() {
+            if (mHistogram) {
+                const auto frame = Clock::now() - mFrameStart - mPaused;
+                mState.SetIterationTime(std::chrono::duration<double>(frame).count());
+                mHistogram->record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(frame).count()));
+            }
+        }
+
+        benchmark::State& mState;
+        Histogram* mHistogram;
+        Clock::time_point mFrameStart{};
+        Clock::time_point mPauseStart{};
+        Clock::duration mPaused{};
+    };
+
+    // Runs a benchmark with per-frame recording switched on and attaches the percentiles.
+    // Register with UseManualTime(): the reported time is the sum of the recorded frames.
+    template <void (*Func)(benchmark::State&)>
+    void perFrame(benchmark::State& state) {
+        Histogram histogram;
+        Histogram* previous = std::exchange(activeHistogram(), &histogram);
+        Func(state);
+        activeHistogram() = previous;
+
+        auto us = [](uint64_t ns) { return static_cast<double>(ns) / 1000.0; };
+        state.counters["p50_us"] = us(histogram.percentile(0.50));
+        state.counters["p99_us"] = us(histogram.percentile(0.99));
+        state.counters["p999_us"] = us(histogram.percentile(0.999));
+        state.counters["max_us"] = us(histogram.max());
+    }
+}
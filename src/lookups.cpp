@@ -0,0 +1,220 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "components.h"
+#include "perf_counters.h"
+#include "registration.h"
+
+// Random access by entity id through each library's public getter, range(0) lookups per iteration.
+// The order the ids are visited in is what varies:
+//  sequential - creation order (the has_component best case)
+//  strided    - every 7919th entity, wrapping around (all entities, no spatial reuse)
+//  shuffled   - uniform random permutation
+//  zipf       - Zipf(s = 1) draws, hot entities scattered over the id range (targetEntity chasing)
+// range(1) = components fetched per lookup: 1 = Position, 2 = + Velocity, 3 = + Health, each in its own storage.
+namespace {
+    enum class Pattern { Sequential, Strided, Shuffled, Zipf };
+
+    constexpr uint32_t kLookupSeed = 0x7E57;
+    constexpr size_t kStride = 7919; // prime, coprime with the power-of-ten entity counts
+
+    std::vector<uint32_t> lookupOrder(Pattern pattern, size_t n) {
+        std::vector<uint32_t> order(n);
+        std::mt19937 rng(kLookupSeed);
+        switch (pattern) {
+            case Pattern::Sequential:
+                std::iota(order.begin(), order.end(), 0u);
+                break;
+            case Pattern::Strided:
+                for (size_t i = 0; i < n; ++i) {
+                    order[i] = static_cast<uint32_t>(i * kStride % n);
+                }
+                break;
+            case Pattern::Shuffled:
+                std::iota(order.begin(), order.end(), 0u);
+                std::shuffle(order.begin(), order.end(), rng);
+                break;
+            case Pattern::Zipf: {
+                std::vector<uint32_t> rankToIndex(n);
+                std::iota(rankToIndex.begin(), rankToIndex.end(), 0u);
+                std::shuffle(rankToIndex.begin(), rankToIndex.end(), rng);
+                std::vector<double> cdf(n);
+                double sum = 0.0;
+                for (size_t k = 0; k < n; ++k) {
+                    sum += 1.0 / static_cast<double>(k + 1);
+                    cdf[k] = sum;
+                }
+                std::uniform_real_distribution<double> uniform(0.0, sum);
+                for (auto& idx : order) {
+                    const size_t rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+                    idx = rankToIndex[std::min(rank, n - 1)];
+                }
+                break;
+            }
+        }
+        return order;
+    }
+
+    template <typename Fetch>
+    void runLookups(benchmark::State& state, const std::vector<uint32_t>& order, Fetch&& fetch) {
+        PERF_ENTITY_COUNTERS(state, static_cast<int64_t>(order.size()));
+        for (auto _ : state) {
+            float accum = 0.f;
+            for (auto idx : order) {
+                accum += fetch(idx);
+            }
+            benchmark::DoNotOptimize(accum);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(order.size()));
+    }
+
+    template <bool ThreadSafe, Pattern P>
+    void ecssLookup(benchmark::State& state) {
+        ecss::Registry<ThreadSafe> reg;
+        const int n = state.range(0);
+        std::vector<ecss::EntityId> ids;
+        ids.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            reg.template addComponent<Position>(e, Position{ (float)i, 0.f, 0.f });
+            reg.template addComponent<Velocity>(e, Velocity{ 1.f, 0.f, 0.f });
+            reg.template addComponent<Health>(e, Health{ 100.f, 100.f, 1.f, false });
+            ids.push_back(e);
+        }
+        const auto order = lookupOrder(P, ids.size());
+        const auto components = state.range(1);
+        runLookups(state, order, [&](uint32_t idx) {
+            const auto id = ids[idx];
+            float value = 0.f;
+            if (auto* p = reg.template getComponent<Position>(id)) value += p->x;
+            if (components >= 2) {
+                if (auto* v = reg.template getComponent<Velocity>(id)) value += v->vx;
+            }
+            if (components >= 3) {
+                if (auto* h = reg.template getComponent<Health>(id)) value += h->current;
+            }
+            return value;
+        });
+    }
+
+    template <Pattern P>
+    void enttLookup(benchmark::State& state) {
+        entt::registry reg;
+        const int n = state.range(0);
+        std::vector<entt::entity> ids(n);
+        reg.create(ids.begin(), ids.end());
+        for (int i = 0; i < n; ++i) {
+            reg.emplace<Position>(ids[i], Position{ (float)i, 0.f, 0.f });
+            reg.emplace<Velocity>(ids[i], Velocity{ 1.f, 0.f, 0.f });
+            reg.emplace<Health>(ids[i], Health{ 100.f, 100.f, 1.f, false });
+        }
+        const auto order = lookupOrder(P, ids.size());
+        const auto components = state.range(1);
+        runLookups(state, order, [&](uint32_t idx) {
+            const auto id = ids[idx];
+            float value = 0.f;
+            if (auto* p = reg.try_get<Position>(id)) value += p->x;
+            if (components >= 2) {
+                if (auto* v = reg.try_get<Velocity>(id)) value += v->vx;
+            }
+            if (components >= 3) {
+                if (auto* h = reg.try_get<Health>(id)) value += h->current;
+            }
+            return value;
+        });
+    }
+
+    template <Pattern P>
+    void flecsLookup(benchmark::State& state) {
+        flecs::world world;
+        world.component<Position>();
+        world.component<Velocity>();
+        world.component<Health>();
+        const int n = state.range(0);
+        std::vector<flecs::entity> ids;
+        ids.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            ids.push_back(world.entity()
+                .set<Position>({ (float)i, 0.f, 0.f })
+                .set<Velocity>({ 1.f, 0.f, 0.f })
+                .set<Health>({ 100.f, 100.f, 1.f, false }));
+        }
+        const auto order = lookupOrder(P, ids.size());
+        const auto components = state.range(1);
+        runLookups(state, order, [&](uint32_t idx) {
+            const auto e = ids[idx];
+            float value = 0.f;
+            if (auto* p = e.try_get<Position>()) value += p->x;
+            if (components >= 2) {
+                if (auto* v = e.try_get<Velocity>()) value += v->vx;
+            }
+            if (components >= 3) {
+                if (auto* h = e.try_get<Health>()) value += h->current;
+            }
+            return value;
+        });
+    }
+}
+
+namespace ecss
+{
+    static void lookup_sequential(benchmark::State& state) { ecssLookup<false, Pattern::Sequential>(state); }
+    static void lookup_strided(benchmark::State& state) { ecssLookup<false, Pattern::Strided>(state); }
+    static void lookup_shuffled(benchmark::State& state) { ecssLookup<false, Pattern::Shuffled>(state); }
+    static void lookup_zipf(benchmark::State& state) { ecssLookup<false, Pattern::Zipf>(state); }
+}
+
+namespace ecss_ts
+{
+    static void lookup_sequential(benchmark::State& state) { ecssLookup<true, Pattern::Sequential>(state); }
+    static void lookup_strided(benchmark::State& state) { ecssLookup<true, Pattern::Strided>(state); }
+    static void lookup_shuffled(benchmark::State& state) { ecssLookup<true, Pattern::Shuffled>(state); }
+    static void lookup_zipf(benchmark::State& state) { ecssLookup<true, Pattern::Zipf>(state); }
+}
+
+namespace entt
+{
+    static void lookup_sequential(benchmark::State& state) { enttLookup<Pattern::Sequential>(state); }
+    static void lookup_strided(benchmark::State& state) { enttLookup<Pattern::Strided>(state); }
+    static void lookup_shuffled(benchmark::State& state) { enttLookup<Pattern::Shuffled>(state); }
+    static void lookup_zipf(benchmark::State& state) { enttLookup<Pattern::Zipf>(state); }
+}
+
+namespace flecs
+{
+    static void lookup_sequential(benchmark::State& state) { flecsLookup<Pattern::Sequential>(state); }
+    static void lookup_strided(benchmark::State& state) { flecsLookup<Pattern::Strided>(state); }
+    static void lookup_shuffled(benchmark::State& state) { flecsLookup<Pattern::Shuffled>(state); }
+    static void lookup_zipf(benchmark::State& state) { flecsLookup<Pattern::Zipf>(state); }
+}
+
+// <ecs>.....................lookup_<pattern>/<entities>/components:<1..3>
+#define BENCH_LOOKUP_ONE(ECS, FUNC) \
+    BENCHMARK(memtrack::tracked<ECS::FUNC>)->Name(TO_FUNC_NAME(FUNC, ECS))->Unit(benchmark::TimeUnit::kMicrosecond) \
+        ->ArgsProduct({{10000, 100000, 1000000}, {1, 2, 3}})->ArgNames({"", "components"})->MinTime(0.3);
+
+#ifdef _MSC_VER
+#define REGISTER_LOOKUP(FUNC) \
+    BENCH_LOOKUP_ONE(ecss, FUNC) \
+    BENCH_LOOKUP_ONE(entt, FUNC) \
+    BENCH_LOOKUP_ONE(flecs, FUNC)
+#else
+#define REGISTER_LOOKUP(FUNC) \
+    BENCH_LOOKUP_ONE(ecss, FUNC) \
+    BENCH_LOOKUP_ONE(ecss_ts, FUNC) \
+    BENCH_LOOKUP_ONE(entt, FUNC) \
+    BENCH_LOOKUP_ONE(flecs, FUNC)
+#endif
+
+REGISTER_LOOKUP(lookup_sequential)
+REGISTER_LOOKUP(lookup_strided)
+REGISTER_LOOKUP(lookup_shuffled)
+REGISTER_LOOKUP(lookup_zipf)
@@ -1,3 +1,21 @@
 #include <benchmark/benchmark.h>
 
-BENCHMARK_MAIN();
\ No newline at end of file
+#if ECSS_BENCH_WORKLOADS
+#include "workload.h"
+#endif
+
+// BENCHMARK_MAIN(), plus the --workload_* flags of ecss_benchmarks (see workload.h)
+int main(int argc, char** argv) {
+#if ECSS_BENCH_WORKLOADS
+    if (!workload::registerFromCommandLine(argc, argv)) {
+        return 1;
+    }
+#endif
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
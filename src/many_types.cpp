@@ -0,0 +1,394 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "components.h"
+#include "registration.h"
+
+// Production-sized type sets: 256 component types (Filler<0..255>), range(1) random archetypes of
+// 30-60 types each, range(0) entities spread over them. Types 0-7 are "common" (each in half of the
+// archetypes), the rest are drawn uniformly, as engine-wide components vs gameplay-specific ones.
+//  many_types_add_remove - 1% of the entities get a type they lack, then lose it again
+//  many_types_view3      - four 3-type views over the common types (each matches ~1/8 of the world)
+//  many_types_destroy    - 10% of the entities destroyed (respawned untimed)
+// Runtime type ids go through fillerTable<> (one indirect call), so the cost stays in the registry's
+// type -> storage lookup rather than in the dispatch.
+namespace {
+    constexpr size_t kTypes = 256;
+    constexpr size_t kCommonTypes = 8;
+    constexpr size_t kMinPerArchetype = 30;
+    constexpr size_t kMaxPerArchetype = 60;
+    constexpr uint32_t kManyTypesSeed = 0x256C;
+
+    struct TypeToggle {
+        uint32_t entity;
+        uint16_t type;
+    };
+
+    // Archetype signatures, the archetype of every entity and the per-frame work lists
+    struct Blueprint {
+        std::vector<std::vector<uint16_t>> archetypes;
+        std::vector<uint32_t> archetypeOf;
+        std::vector<TypeToggle> toggles;
+        std::vector<uint32_t> victims;
+
+        explicit Blueprint(const benchmark::State& state) {
+            std::mt19937 rng(kManyTypesSeed);
+            const size_t n = static_cast<size_t>(state.range(0));
+            archetypes.resize(static_cast<size_t>(state.range(1)));
+            for (auto& types : archetypes) {
+                std::vector<bool> used(kTypes, false);
+                for (size_t t = 0; t < kCommonTypes; ++t) {
+                    used[t] = rng() % 2 == 0;
+                }
+                const size_t target = kMinPerArchetype + rng() % (kMaxPerArchetype - kMinPerArchetype + 1);
+                size_t count = static_cast<size_t>(std::count(used.begin(), used.end(), true));
+                while (count < target) {
+                    const size_t t = kCommonTypes + rng() % (kTypes - kCommonTypes);
+                    if (!used[t]) {
+                        used[t] = true;
+                        ++count;
+                    }
+                }
+                for (size_t t = 0; t < kTypes; ++t) {
+                    if (used[t]) {
+                        types.push_back(static_cast<uint16_t>(t));
+                    }
+                }
+            }
+
+            archetypeOf.resize(n);
+            for (auto& a : archetypeOf) {
+                a = static_cast<uint32_t>(rng() % archetypes.size());
+            }
+
+            for (size_t i = 0, touched = std::max<size_t>(1, n / 100); i < touched; ++i) {
+                const auto e = static_cast<uint32_t>(rng() % n);
+                const auto& types = archetypes[archetypeOf[e]];
+                uint16_t t;
+                do {
+                    t = static_cast<uint16_t>(rng() % kTypes);
+                } while (std::binary_search(types.begin(), types.end(), t));
+                toggles.push_back({ e, t });
+            }
+            // one toggle per entity, so add/remove pairs never collide within a frame
+            std::sort(toggles.begin(), toggles.end(), [](const TypeToggle& a, const TypeToggle& b) { return a.entity < b.entity; });
+            toggles.erase(std::unique(toggles.begin(), toggles.end(), [](const TypeToggle& a, const TypeToggle& b) { return a.entity == b.entity; }), toggles.end());
+
+            victims.resize(n);
+            std::iota(victims.begin(), victims.end(), 0u);
+            std::shuffle(victims.begin(), victims.end(), rng);
+            victims.resize(std::max<size_t>(1, n / 10));
+        }
+
+        const std::vector<uint16_t>& typesOf(uint32_t entity) const { return archetypes[archetypeOf[entity]]; }
+
+        double componentsPerEntity() const {
+            double total = 0.0;
+            for (auto a : archetypeOf) {
+                total += static_cast<double>(archetypes[a].size());
+            }
+            return archetypeOf.empty() ? 0.0 : total / static_cast<double>(archetypeOf.size());
+        }
+    };
+
+    void reportWorld(benchmark::State& state, const Blueprint& blueprint, size_t itemsPerFrame) {
+        state.counters["components_per_entity"] = blueprint.componentsPerEntity();
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(itemsPerFrame));
+    }
+
+    template <typename A, typename B, typename C>
+    void touch(A& a, B& b, C& c) {
+        a.value += b.value * c.value;
+    }
+}
+
+namespace realistic {
+namespace ecss_r {
+    using Reg = ecss::Registry<false>;
+    using ecss::EntityId;
+
+    struct AddOp {
+        template <typename T>
+        static void apply(Reg& reg, EntityId e) { reg.addComponent<T>(e, T{ 1.f }); }
+    };
+    struct RemoveOp {
+        template <typename T>
+        static void apply(Reg& reg, EntityId e) { reg.destroyComponent<T>(e); }
+    };
+    constexpr auto kAdd = fillerTable<AddOp, kTypes>();
+    constexpr auto kRemove = fillerTable<RemoveOp, kTypes>();
+
+    struct ManyTypesWorld {
+        Reg reg;
+        Blueprint blueprint;
+        std::vector<EntityId> ids;
+
+        explicit ManyTypesWorld(const benchmark::State& state) : blueprint(state) {
+            ids.resize(blueprint.archetypeOf.size());
+            for (uint32_t i = 0; i < ids.size(); ++i) {
+                spawn(i);
+            }
+        }
+
+        void spawn(uint32_t i) {
+            ids[i] = reg.takeEntity();
+            for (auto t : blueprint.typesOf(i)) {
+                kAdd[t](reg, ids[i]);
+            }
+        }
+    };
+
+    static void many_types_add_remove(benchmark::State& state) {
+        ManyTypesWorld world(state);
+        for (auto _ : state) {
+            for (const auto& toggle : world.blueprint.toggles) {
+                kAdd[toggle.type](world.reg, world.ids[toggle.entity]);
+            }
+            for (const auto& toggle : world.blueprint.toggles) {
+                kRemove[toggle.type](world.reg, world.ids[toggle.entity]);
+            }
+            benchmark::ClobberMemory();
+        }
+        reportWorld(state, world.blueprint, world.blueprint.toggles.size() * 2);
+    }
+
+    static void many_types_view3(benchmark::State& state) {
+        ManyTypesWorld world(state);
+        auto v0 = world.reg.view<Filler<0>, Filler<1>, Filler<2>>();
+        auto v1 = world.reg.view<Filler<3>, Filler<4>, Filler<5>>();
+        auto v2 = world.reg.view<Filler<1>, Filler<4>, Filler<6>>();
+        auto v3 = world.reg.view<Filler<2>, Filler<5>, Filler<7>>();
+        for (auto _ : state) {
+            v0.each([](Filler<0>& a, Filler<1>& b, Filler<2>& c) { touch(a, b, c); });
+            v1.each([](Filler<3>& a, Filler<4>& b, Filler<5>& c) { touch(a, b, c); });
+            v2.each([](Filler<1>& a, Filler<4>& b, Filler<6>& c) { touch(a, b, c); });
+            v3.each([](Filler<2>& a, Filler<5>& b, Filler<7>& c) { touch(a, b, c); });
+            benchmark::ClobberMemory();
+        }
+        reportWorld(state, world.blueprint, world.ids.size());
+    }
+
+    static void many_types_destroy(benchmark::State& state) {
+        ManyTypesWorld world(state);
+        std::vector<EntityId> victims;
+        victims.reserve(world.blueprint.victims.size());
+        for (auto _ : state) {
+            state.PauseTiming();
+            victims.clear();
+            for (auto v : world.blueprint.victims) {
+                victims.push_back(world.ids[v]);
+            }
+            state.ResumeTiming();
+
+            world.reg.destroyEntities(victims);
+
+            state.PauseTiming();
+            for (auto v : world.blueprint.victims) {
+                world.spawn(v);
+            }
+            state.ResumeTiming();
+        }
+        reportWorld(state, world.blueprint, world.blueprint.victims.size());
+    }
+} // namespace ecss_r
+
+namespace entt_r {
+    struct AddOp {
+        template <typename T>
+        static void apply(entt::registry& reg, entt::entity e) { reg.emplace<T>(e, T{ 1.f }); }
+    };
+    struct RemoveOp {
+        template <typename T>
+        static void apply(entt::registry& reg, entt::entity e) { reg.remove<T>(e); }
+    };
+    constexpr auto kAdd = fillerTable<AddOp, kTypes>();
+    constexpr auto kRemove = fillerTable<RemoveOp, kTypes>();
+
+    struct ManyTypesWorld {
+        entt::registry reg;
+        Blueprint blueprint;
+        std::vector<entt::entity> ids;
+
+        explicit ManyTypesWorld(const benchmark::State& state) : blueprint(state) {
+            ids.resize(blueprint.archetypeOf.size());
+            for (uint32_t i = 0; i < ids.size(); ++i) {
+                spawn(i);
+            }
+        }
+
+        void spawn(uint32_t i) {
+            ids[i] = reg.create();
+            for (auto t : blueprint.typesOf(i)) {
+                kAdd[t](reg, ids[i]);
+            }
+        }
+    };
+
+    static void many_types_add_remove(benchmark::State& state) {
+        ManyTypesWorld world(state);
+        for (auto _ : state) {
+            for (const auto& toggle : world.blueprint.toggles) {
+                kAdd[toggle.type](world.reg, world.ids[toggle.entity]);
+            }
+            for (const auto& toggle : world.blueprint.toggles) {
+                kRemove[toggle.type](world.reg, world.ids[toggle.entity]);
+            }
+            benchmark::ClobberMemory();
+        }
+        reportWorld(state, world.blueprint, world.blueprint.toggles.size() * 2);
+    }
+
+    static void many_types_view3(benchmark::State& state) {
+        ManyTypesWorld world(state);
+        auto v0 = world.reg.view<Filler<0>, Filler<1>, Filler<2>>();
+        auto v1 = world.reg.view<Filler<3>, Filler<4>, Filler<5>>();
+        auto v2 = world.reg.view<Filler<1>, Filler<4>, Filler<6>>();
+        auto v3 = world.reg.view<Filler<2>, Filler<5>, Filler<7>>();
+        for (auto _ : state) {
+            v0.each([](Filler<0>& a, Filler<1>& b, Filler<2>& c) { touch(a, b, c); });
+            v1.each([](Filler<3>& a, Filler<4>& b, Filler<5>& c) { touch(a, b, c); });
+            v2.each([](Filler<1>& a, Filler<4>& b, Filler<6>& c) { touch(a, b, c); });
+            v3.each([](Filler<2>& a, Filler<5>& b, Filler<7>& c) { touch(a, b, c); });
+            benchmark::ClobberMemory();
+        }
+        reportWorld(state, world.blueprint, world.ids.size());
+    }
+
+    // registry::destroy walks every pool (256 here) to strip the entity
+    static void many_types_destroy(benchmark::State& state) {
+        ManyTypesWorld world(state);
+        std::vector<entt::entity> victims;
+        victims.reserve(world.blueprint.victims.size());
+        for (auto _ : state) {
+            state.PauseTiming();
+            victims.clear();
+            for (auto v : world.blueprint.victims) {
+                victims.push_back(world.ids[v]);
+            }
+            state.ResumeTiming();
+
+            world.reg.destroy(victims.begin(), victims.end());
+
+            state.PauseTiming();
+            for (auto v : world.blueprint.victims) {
+                world.spawn(v);
+            }
+            state.ResumeTiming();
+        }
+        reportWorld(state, world.blueprint, world.blueprint.victims.size());
+    }
+} // namespace entt_r
+
+namespace flecs_r {
+    struct AddOp {
+        template <typename T>
+        static void apply(flecs::entity e) { e.set<T>(T{ 1.f }); }
+    };
+    struct RemoveOp {
+        template <typename T>
+        static void apply(flecs::entity e) { e.remove<T>(); }
+    };
+    constexpr auto kAdd = fillerTable<AddOp, kTypes>();
+    constexpr auto kRemove = fillerTable<RemoveOp, kTypes>();
+
+    struct RegisterOp {
+        template <typename T>
+        static void apply(flecs::world& world) { world.component<T>(); }
+    };
+
+    // Spawns are deferred so the 30-60 sets of an entity land in its final table in one move,
+    // instead of creating a table per prefix of the signature
+    struct ManyTypesWorld {
+        flecs::world world;
+        Blueprint blueprint;
+        std::vector<flecs::entity> ids;
+
+        explicit ManyTypesWorld(const benchmark::State& state) : blueprint(state) {
+            for (auto registerType : fillerTable<RegisterOp, kTypes>()) {
+                registerType(world);
+            }
+            ids.resize(blueprint.archetypeOf.size());
+            for (uint32_t i = 0; i < ids.size(); ++i) {
+                spawn(i);
+            }
+        }
+
+        void spawn(uint32_t i) {
+            world.defer_begin();
+            ids[i] = world.entity();
+            for (auto t : blueprint.typesOf(i)) {
+                kAdd[t](ids[i]);
+            }
+            world.defer_end();
+        }
+    };
+
+    static void many_types_add_remove(benchmark::State& state) {
+        ManyTypesWorld world(state);
+        for (auto _ : state) {
+            for (const auto& toggle : world.blueprint.toggles) {
+                kAdd[toggle.type](world.ids[toggle.entity]);
+            }
+            for (const auto& toggle : world.blueprint.toggles) {
+                kRemove[toggle.type](world.ids[toggle.entity]);
+            }
+            benchmark::ClobberMemory();
+        }
+        reportWorld(state, world.blueprint, world.blueprint.toggles.size() * 2);
+    }
+
+    static void many_types_view3(benchmark::State& state) {
+        ManyTypesWorld world(state);
+        auto q0 = world.world.query<Filler<0>, Filler<1>, Filler<2>>();
+        auto q1 = world.world.query<Filler<3>, Filler<4>, Filler<5>>();
+        auto q2 = world.world.query<Filler<1>, Filler<4>, Filler<6>>();
+        auto q3 = world.world.query<Filler<2>, Filler<5>, Filler<7>>();
+        for (auto _ : state) {
+            q0.each([](Filler<0>& a, Filler<1>& b, Filler<2>& c) { touch(a, b, c); });
+            q1.each([](Filler<3>& a, Filler<4>& b, Filler<5>& c) { touch(a, b, c); });
+            q2.each([](Filler<1>& a, Filler<4>& b, Filler<6>& c) { touch(a, b, c); });
+            q3.each([](Filler<2>& a, Filler<5>& b, Filler<7>& c) { touch(a, b, c); });
+            benchmark::ClobberMemory();
+        }
+        reportWorld(state, world.blueprint, world.ids.size());
+    }
+
+    static void many_types_destroy(benchmark::State& state) {
+        ManyTypesWorld world(state);
+        for (auto _ : state) {
+            for (auto v : world.blueprint.victims) {
+                world.ids[v].destruct();
+            }
+
+            state.PauseTiming();
+            for (auto v : world.blueprint.victims) {
+                world.spawn(v);
+            }
+            state.ResumeTiming();
+        }
+        reportWorld(state, world.blueprint, world.blueprint.victims.size());
+    }
+} // namespace flecs_r
+} // namespace realistic
+
+// realistic/<ecs>/many_types_*/<entities>/archetypes:<N>
+#define BENCH_MANY_TYPES_ONE(ECS, FUNC) \
+    BENCHMARK(memtrack::tracked<realistic::ECS::FUNC>)->Name("realistic/" #ECS "/" #FUNC) \
+        ->Unit(benchmark::TimeUnit::kMicrosecond)->ArgsProduct({{10000, 100000}, {16, 1024}})->ArgNames({"", "archetypes"})->MinTime(0.3);
+
+#define REGISTER_MANY_TYPES(FUNC) \
+    BENCH_MANY_TYPES_ONE(ecss_r, FUNC) \
+    BENCH_MANY_TYPES_ONE(entt_r, FUNC) \
+    BENCH_MANY_TYPES_ONE(flecs_r, FUNC)
+
+REGISTER_MANY_TYPES(many_types_add_remove)
+REGISTER_MANY_TYPES(many_types_view3)
+REGISTER_MANY_TYPES(many_types_destroy)
@@ -0,0 +1,442 @@
+#include "memory_tracking.h"
+
+#if ECSS_BENCH_ARENA
+
+#include <flecs.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    // Arena blocks carry their size in a header in front of the user pointer (16 bytes keeps malloc's
+    // alignment) and are recognised by address. Heap blocks only get the header when counting, since
+    // unsized delete needs the size; otherwise they go straight to malloc/free.
+    constexpr bool kCounting = memtrack::enabled;
+    constexpr size_t kHeader = 16;
+    constexpr size_t kArenaBytes = size_t(1) << 30;
+    constexpr size_t kPageBytes = 4096;
+    constexpr size_t kHugeArenaBytes = size_t(16) << 30; // reserved, not committed
+    constexpr size_t kHugePageBytes = size_t(2) << 20;
+
+    std::atomic<int64_t> gLive{ 0 };
+    std::atomic<int64_t> gPeak{ 0 };
+    std::atomic<uint64_t> gAllocs{ 0 };
+
+    void onAlloc(size_t size) {
+        if constexpr (!kCounting) {
+            return;
+        }
+        gAllocs.fetch_add(1, std::memory_order_relaxed);
+        const int64_t live = gLive.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) + static_cast<int64_t>(size);
+        int64_t peak = gPeak.load(std::memory_order_relaxed);
+        while (live > peak && !gPeak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+    }
+
+    void onFree(size_t size) {
+        if constexpr (!kCounting) {
+            return;
+        }
+        gLive.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+    }
+
+    size_t& sizeOf(std::byte* user) {
+        return *reinterpret_cast<size_t*>(user - sizeof(size_t));
+    }
+
+    // Gives the pages of [block, block + bytes) back to the kernel; the next write faults them in again
+    void discardPages(std::byte* block, size_t bytes) {
+#ifdef __linux__
+        if (bytes > 0) {
+            madvise(block, bytes, MADV_DONTNEED);
+        }
+#else
+        (void)block;
+        (void)bytes;
+#endif
+    }
+
+    // Power-of-two size classes over one pre-faulted bump block. Freed blocks go to their class' free list
+    // and are handed out again, so a registry rebuilt every iteration reuses the same warm pages.
+    // Single-threaded, like the benchmarks using it; requests it cannot serve fall back to the heap.
+    // The huge-page variant maps its block instead (see mapHugeArena) and is not pre-faulted: pages are
+    // first-touched by the benchmark's setup and discarded again once the arena is empty.
+    struct Arena {
+        std::byte* block = nullptr;
+        size_t capacity = kArenaBytes;
+        size_t pageBytes = kPageBytes;
+        memtrack::HugePages hugePages = memtrack::HugePages::None;
+        int numaNode = -1;
+        size_t used = 0;
+        int64_t liveBlocks = 0;
+        std::array<void*, 48> freeLists{};
+
+        Arena() {
+            block = static_cast<std::byte*>(std::malloc(kArenaBytes));
+            if (block) {
+                for (size_t offset = 0; offset < kArenaBytes; offset += kPageBytes) {
+                    block[offset] = std::byte{ 0 };
+                }
+            }
+        }
+
+        Arena(std::byte* mapped, size_t bytes, memtrack::HugePages mode)
+            : block(mapped), capacity(bytes), pageBytes(kHugePageBytes), hugePages(mode) {}
+
+        bool contains(const std::byte* ptr) const {
+            return block && ptr >= block && ptr < block + capacity;
+        }
+
+        static size_t classOf(size_t bytes) {
+            size_t cls = 4;
+            while ((size_t(1) << cls) < bytes) {
+                ++cls;
+            }
+            return cls;
+        }
+
+        void* allocate(size_t bytes, size_t align) {
+            const size_t cls = classOf(bytes > align ? bytes : align);
+            if (cls >= freeLists.size() || !block) {
+                return nullptr;
+            }
+            if (void* head = freeLists[cls]) {
+                freeLists[cls] = *static_cast<void**>(head);
+                ++liveBlocks;
+                return head;
+            }
+            const size_t size = size_t(1) << cls;
+            const size_t boundary = size < pageBytes ? size : (align > pageBytes ? align : pageBytes);
+            const size_t offset = (used + boundary - 1) / boundary * boundary;
+            if (offset + size > capacity) {
+                return nullptr;
+            }
+            used = offset + size;
+            ++liveBlocks;
+            return block + offset;
+        }
+
+        void deallocate(void* ptr, size_t bytes, size_t align) {
+            const size_t cls = classOf(bytes > align ? bytes : align);
+            *static_cast<void**>(ptr) = freeLists[cls];
+            freeLists[cls] = ptr;
+            --liveBlocks;
+        }
+
+        // Back to an empty block once everything allocated in it is gone
+        void releaseIfEmpty() {
+            if (liveBlocks == 0) {
+                if (pageBytes == kHugePageBytes) {
+                    discardPages(block, used);
+                }
+                used = 0;
+                freeLists.fill(nullptr);
+            }
+        }
+    };
+
+#ifdef __linux__
+    // madvise(MADV_HUGEPAGE) succeeds even when THP is switched off system-wide
+    bool transparentHugePagesDisabled() {
+        std::FILE* file = std::fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+        if (!file) {
+            return true;
+        }
+        char mode[128] = {};
+        const bool read = std::fgets(mode, sizeof(mode), file) != nullptr;
+        std::fclose(file);
+        return !read || std::strstr(mode, "[never]") != nullptr;
+    }
+
+    // Explicit 2 MiB pages from the hugetlbfs pool (vm.nr_hugepages) when it can back the whole block,
+    // transparent huge pages otherwise. Halves the size until the kernel accepts the reservation.
+    Arena* mapHugeArena() {
+        for (size_t bytes = kHugeArenaBytes; bytes >= kArenaBytes; bytes /= 2) {
+            void* mapped = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (mapped != MAP_FAILED) {
+                return new Arena(static_cast<std::byte*>(mapped), bytes, memtrack::HugePages::Explicit);
+            }
+        }
+        for (size_t bytes = kHugeArenaBytes; bytes >= kArenaBytes; bytes /= 2) {
+            // One extra huge page so the block can start on a 2 MiB boundary
+            void* mapped = mmap(nullptr, bytes + kHugePageBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+            if (mapped == MAP_FAILED) {
+                continue;
+            }
+            const auto address = reinterpret_cast<uintptr_t>(mapped);
+            auto* block = reinterpret_cast<std::byte*>((address + kHugePageBytes - 1) / kHugePageBytes * kHugePageBytes);
+            const bool granted = madvise(block, bytes, MADV_HUGEPAGE) == 0 && !transparentHugePagesDisabled();
+            return new Arena(block, bytes, granted ? memtrack::HugePages::Transparent : memtrack::HugePages::None);
+        }
+        return nullptr;
+    }
+
+    // Prefers the NUMA node the calling thread runs on for every page faulted in from now on.
+    // Only affects pages not yet touched, which is all of them right after discardPages().
+    void preferCurrentNode(Arena& arena) {
+        unsigned cpu = 0;
+        unsigned node = 0;
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+            arena.numaNode = -1;
+            return;
+        }
+        arena.numaNode = static_cast<int>(node);
+
+        std::array<unsigned long, 16> nodes{};
+        constexpr size_t kBitsPerWord = sizeof(unsigned long) * 8;
+        if (node < nodes.size() * kBitsPerWord) {
+            nodes[node / kBitsPerWord] = 1ul << (node % kBitsPerWord);
+            // Fails without NUMA support in the kernel; first touch from this thread still lands locally
+            syscall(SYS_mbind, arena.block, arena.capacity, MPOL_PREFERRED, nodes.data(), nodes.size() * kBitsPerWord, 0);
+        }
+    }
+#else
+    Arena* mapHugeArena() { return nullptr; }
+    void preferCurrentNode(Arena&) {}
+#endif
+
+    Arena* gArena = nullptr;      // created by the first ArenaScope, never destroyed
+    Arena* gHugeArena = nullptr;  // created by the first Pages::Huge scope (if the kernel maps it), never destroyed
+    bool gHugeArenaMapped = false;
+    Arena* gActiveArena = nullptr;
+
+    Arena* arenaOf(const std::byte* user) {
+        if (gArena && gArena->contains(user)) {
+            return gArena;
+        }
+        if (gHugeArena && gHugeArena->contains(user)) {
+            return gHugeArena;
+        }
+        return nullptr;
+    }
+
+    std::byte* heapAlloc(size_t bytes, size_t align) {
+        if (align <= kHeader) {
+            return static_cast<std::byte*>(std::malloc(bytes));
+        }
+#ifdef _MSC_VER
+        return static_cast<std::byte*>(_aligned_malloc(bytes, align));
+#else
+        return static_cast<std::byte*>(std::aligned_alloc(align, (bytes + align - 1) / align * align));
+#endif
+    }
+
+    void heapFree(std::byte* raw, size_t align) {
+        if (align <= kHeader) {
+            std::free(raw);
+            return;
+        }
+#ifdef _MSC_VER
+        _aligned_free(raw);
+#else
+        std::free(raw);
+#endif
+    }
+
+    // Over-aligned blocks: the header grows to one alignment unit, the size stored right before the user pointer
+    size_t headerFor(size_t align) {
+        return align < kHeader ? kHeader : align;
+    }
+
+    size_t totalFor(size_t size, size_t align) {
+        const size_t header = headerFor(align);
+        return (size + header + header - 1) / header * header;
+    }
+
+    void* trackedAlignedMalloc(size_t size, size_t align) {
+        const size_t header = headerFor(align);
+        const size_t total = totalFor(size, align);
+        auto* raw = gActiveArena ? static_cast<std::byte*>(gActiveArena->allocate(total, header)) : nullptr;
+        if (!raw) {
+            if constexpr (!kCounting) {
+                return heapAlloc(size, align);
+            }
+            raw = heapAlloc(total, header);
+            if (!raw) {
+                return nullptr;
+            }
+        }
+        std::byte* user = raw + header;
+        sizeOf(user) = size;
+        onAlloc(size);
+        return user;
+    }
+
+    void trackedAlignedFree(void* ptr, size_t align) {
+        if (!ptr) {
+            return;
+        }
+        auto* user = static_cast<std::byte*>(ptr);
+        Arena* arena = arenaOf(user);
+        if (!arena && !kCounting) {
+            heapFree(user, align);
+            return;
+        }
+        const size_t size = sizeOf(user);
+        onFree(size);
+        const size_t header = headerFor(align);
+        if (arena) {
+            arena->deallocate(user - header, totalFor(size, align), header);
+        } else {
+            heapFree(user - header, header);
+        }
+    }
+
+    void* trackedMalloc(size_t size) {
+        return trackedAlignedMalloc(size, kHeader);
+    }
+
+    void trackedFree(void* ptr) {
+        trackedAlignedFree(ptr, kHeader);
+    }
+
+    void* trackedRealloc(void* ptr, size_t size) {
+        if (!ptr) {
+            return trackedMalloc(size);
+        }
+        auto* user = static_cast<std::byte*>(ptr);
+        const bool inArena = arenaOf(user) != nullptr;
+        if (!inArena && !kCounting) {
+            // No header, so the old size is unknown: heap blocks keep growing on the heap, even inside a scope
+            return std::realloc(user, size);
+        }
+        const size_t oldSize = sizeOf(user);
+        if (!inArena && !gActiveArena) {
+            auto* moved = static_cast<std::byte*>(std::realloc(user - kHeader, size + kHeader));
+            if (!moved) {
+                return nullptr;
+            }
+            sizeOf(moved + kHeader) = size;
+            onFree(oldSize);
+            onAlloc(size);
+            return moved + kHeader;
+        }
+        // Arena blocks (or heap blocks grown while an arena is active) move by copy
+        void* moved = trackedMalloc(size);
+        if (!moved) {
+            return nullptr;
+        }
+        std::memcpy(moved, ptr, oldSize < size ? oldSize : size);
+        trackedFree(ptr);
+        return moved;
+    }
+
+    void* newOrThrow(size_t size) {
+        if (void* ptr = trackedMalloc(size ? size : 1)) {
+            return ptr;
+        }
+        throw std::bad_alloc();
+    }
+
+    void* newAlignedOrThrow(size_t size, std::align_val_t align) {
+        if (void* ptr = trackedAlignedMalloc(size ? size : 1, static_cast<size_t>(align))) {
+            return ptr;
+        }
+        throw std::bad_alloc();
+    }
+
+    // flecs allocates through ecs_os_api, not operator new
+    void* flecsMalloc(ecs_size_t size) { return trackedMalloc(static_cast<size_t>(size)); }
+    void* flecsRealloc(void* ptr, ecs_size_t size) { return trackedRealloc(ptr, static_cast<size_t>(size)); }
+    void flecsFree(void* ptr) { trackedFree(ptr); }
+    void* flecsCalloc(ecs_size_t size) {
+        void* ptr = trackedMalloc(static_cast<size_t>(size));
+        if (ptr) {
+            std::memset(ptr, 0, static_cast<size_t>(size));
+        }
+        return ptr;
+    }
+
+    // Runs before main(), i.e. before any flecs world exists
+    const bool gFlecsHooksInstalled = [] {
+        ecs_os_set_api_defaults();
+        ecs_os_api_t api = ecs_os_api;
+        api.malloc_ = flecsMalloc;
+        api.realloc_ = flecsRealloc;
+        api.calloc_ = flecsCalloc;
+        api.free_ = flecsFree;
+        ecs_os_set_api(&api);
+        return true;
+    }();
+}
+
+namespace memtrack {
+    Snapshot snapshot() {
+        return Snapshot{
+            gLive.load(std::memory_order_relaxed),
+            gPeak.load(std::memory_order_relaxed),
+            gAllocs.load(std::memory_order_relaxed)
+        };
+    }
+
+    void resetPeak() {
+        gPeak.store(gLive.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    ArenaScope::ArenaScope(Pages pages) {
+        // Arenas are allocated from the heap, before routing is switched on
+        if (pages == Pages::Huge) {
+            if (!gHugeArenaMapped) {
+                gHugeArena = mapHugeArena();
+                gHugeArenaMapped = true;
+            }
+            if (gHugeArena) {
+                preferCurrentNode(*gHugeArena);
+                gActiveArena = gHugeArena;
+                return;
+            }
+        }
+        if (!gArena) {
+            gArena = new Arena();
+        }
+        gActiveArena = gArena;
+    }
+
+    ArenaScope::~ArenaScope() {
+        Arena* arena = gActiveArena;
+        gActiveArena = nullptr;
+        arena->releaseIfEmpty();
+    }
+
+    PagePlacement hugePagePlacement() {
+        if (!gHugeArena) {
+            return PagePlacement{};
+        }
+        return PagePlacement{ gHugeArena->hugePages, gHugeArena->numaNode };
+    }
+}
+
+void* operator new(size_t size) { return newOrThrow(size); }
+void* operator new[](size_t size) { return newOrThrow(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return trackedMalloc(size ? size : 1); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return trackedMalloc(size ? size : 1); }
+void* operator new(size_t size, std::align_val_t align) { return newAlignedOrThrow(size, align); }
+void* operator new[](size_t size, std::align_val_t align) { return newAlignedOrThrow(size, align); }
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return trackedAlignedMalloc(size ? size : 1, static_cast<size_t>(align)); }
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return trackedAlignedMalloc(size ? size : 1, static_cast<size_t>(align)); }
+
+void operator delete(void* ptr) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t align) noexcept { trackedAlignedFree(ptr, static_cast<size_t>(align)); }
+void operator delete[](void* ptr, std::align_val_t align) noexcept { trackedAlignedFree(ptr, static_cast<size_t>(align)); }
+void operator delete(void* ptr, size_t, std::align_val_t align) noexcept { trackedAlignedFree(ptr, static_cast<size_t>(align)); }
+void operator delete[](void* ptr, size_t, std::align_val_t align) noexcept { trackedAlignedFree(ptr, static_cast<size_t>(align)); }
+void operator delete(void* ptr, std::align_val_t align, const std::nothrow_t&) noexcept { trackedAlignedFree(ptr, static_cast<size_t>(align)); }
+void operator delete[](void* ptr, std::align_val_t align, const std::nothrow_t&) noexcept { trackedAlignedFree(ptr, static_cast<size_t>(align)); }
+
+#endif
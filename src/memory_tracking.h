@@ -0,0 +1,122 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#ifndef ECSS_BENCH_MEMORY_TRACKING
+#define ECSS_BENCH_MEMORY_TRACKING 0
+#endif
+
+// The counters sit on the same allocator hooks as the arenas
+#if ECSS_BENCH_MEMORY_TRACKING
+#undef ECSS_BENCH_ARENA
+#define ECSS_BENCH_ARENA 1
+#elif !defined(ECSS_BENCH_ARENA)
+#define ECSS_BENCH_ARENA 0
+#endif
+
+// Global heap accounting and arena routing for ecss_benchmarks.
+// memory_tracking.cpp replaces operator new/delete and installs flecs' ecs_os_api malloc hooks,
+// so ECSS sectors, EnTT sparse sets and flecs tables all land in the same counters and arenas.
+// ECSS_BENCH_ARENA alone installs the hooks for ArenaScope without counting: outside a scope they
+// forward to malloc/free with no header and no atomics, so the timing build is left undisturbed.
+namespace memtrack {
+    constexpr bool enabled = ECSS_BENCH_MEMORY_TRACKING != 0;
+    constexpr bool arenas = ECSS_BENCH_ARENA != 0;
+
+    struct Snapshot {
+        int64_t liveBytes = 0;  // currently allocated
+        int64_t peakBytes = 0;  // high-water mark since the last resetPeak()
+        uint64_t allocs = 0;    // allocation calls since startup (realloc counts as one)
+    };
+
+    Snapshot snapshot();
+    void resetPeak();
+
+    enum class Pages { Default, Huge };
+
+    // While alive, operator new and the flecs os-api hooks are served from a pre-faulted 1 GiB block
+    // with power-of-two free lists (heap fallback once it is full).
+    // Pages::Huge uses a separate arena of up to 16 GiB on 2 MiB pages instead (Linux; the default arena
+    // elsewhere or when the kernel refuses the mapping), see hugePagePlacement().
+    // Blocks freed after the scope ends still go back to the arena. Not thread-safe: single-threaded benchmarks only.
+    class ArenaScope {
+    public:
+        explicit ArenaScope(Pages pages = Pages::Default);
+        ~ArenaScope();
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+    };
+
+    enum class HugePages { None = 0, Transparent = 1, Explicit = 2 };
+
+    // How the huge-page arena got its memory: hugetlbfs pages (vm.nr_hugepages), THP via madvise, or
+    // neither (THP off, not Linux). Blocks of 2 MiB and up start on a huge-page boundary. Each Pages::Huge
+    // scope binds the arena, mbind(MPOL_PREFERRED), to the NUMA node its thread runs on (-1 if unknown);
+    // pages are first-touched by the benchmark's setup and handed back to the kernel once the arena is empty.
+    struct PagePlacement {
+        HugePages hugePages = HugePages::None;
+        int numaNode = -1;
+    };
+
+    PagePlacement hugePagePlacement();
+
+    // Runs a benchmark and attaches its memory footprint:
+    //  peak_bytes       - heap high-water mark above the level at benchmark start (setup included)
+    //  bytes_per_entity - peak_bytes / state.range(0)
+    //  allocs           - allocation calls per iteration (setup amortized over the iterations)
+    // track(state, run) does the same for callables registered at runtime (RegisterBenchmark).
+    template <typename Fn>
+    void track(benchmark::State& state, Fn&& run) {
+        if constexpr (!enabled) {
+            run(state);
+        } else {
+            resetPeak();
+            const Snapshot before = snapshot();
+            run(state);
+            const Snapshot after = snapshot();
+
+            const double peak = static_cast<double>(after.peakBytes - before.liveBytes);
+            const double iterations = state.iterations() > 0 ? static_cast<double>(state.iterations()) : 1.0;
+            state.counters["peak_bytes"] = benchmark::Counter(peak, benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
+            state.counters["bytes_per_entity"] = peak / static_cast<double>(state.range(0));
+            state.counters["allocs"] = static_cast<double>(after.allocs - before.allocs) / iterations;
+        }
+    }
+
+    template <void (*Func)(benchmark::State&)>
+    void tracked(benchmark::State& state) {
+        track(state, Func);
+    }
+
+    // Runs a benchmark with its allocations routed to the arena, so a registry rebuilt inside the timing
+    // loop no longer pays for page faults and general-purpose malloc. Needs the allocator hooks
+    // (ECSS_BENCH_ARENA); otherwise it is a plain passthrough.
+    template <void (*Func)(benchmark::State&)>
+    void withArena(benchmark::State& state) {
+        if constexpr (!arenas) {
+            Func(state);
+        } else {
+            ArenaScope scope;
+            Func(state);
+        }
+    }
+
+    // Same with the huge-page arena, so the registry's sectors sit on 2 MiB pages local to the benchmark
+    // thread. Adds huge_pages (HugePages as a number) and numa_node counters; plain rows are the 4 KiB baseline.
+    template <void (*Func)(benchmark::State&)>
+    void withHugePages(benchmark::State& state) {
+        if constexpr (!arenas) {
+            Func(state);
+        } else {
+            {
+                ArenaScope scope(Pages::Huge);
+                Func(state);
+            }
+            const PagePlacement placement = hugePagePlacement();
+            state.counters["huge_pages"] = static_cast<double>(placement.hugePages);
+            state.counters["numa_node"] = static_cast<double>(placement.numaNode);
+        }
+    }
+}
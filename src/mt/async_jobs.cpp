@@ -0,0 +1,238 @@
+#include <benchmark/benchmark.h>
+#include <ecss/Registry.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "components.h"
+#include "mt/task_graph.h"
+#include "mt/thread_pool.h"
+
+// =====================================================================
+// ASYNC PRODUCERS / CONSUMERS ON ONE Registry<true> (ecss_benchmarks_mt)
+// Every frame runs, side by side on mt::WorkStealingPool and without dependencies between them
+// (Registry<true> does its own locking, so the systems declare no access sets):
+//   spawn    - producers: take range(0) / 10 entities and add Position + Velocity (chunked)
+//   despawn  - producers: destroy the batch spawned the frame before (chunked), so the population stays steady
+//   reader_k - consumers: max(1, threads / 2) jobs, each iterating the whole Position + Velocity view
+// Counters (per frame unless noted):
+//   spawned_per_second / iterated_per_second - producer and consumer throughput
+//   producer_stall_us / producer_stalls - time in, and number of, 64-entity producer blocks slower than 50 us
+//   max_block_us - slowest producer block of the run
+//   reader_wait_us / max_reader_wait_us - from each() to the first entity (time to get into the view), mean / max
+// Also registered on MSVC, where the ecss_ts rows of ecss_benchmarks are skipped because the atomic
+// wait()/notify_all() in Registry<true> hangs: a watchdog reports a frame that makes no progress for
+// 10 s and exits with code 3 instead of letting the run time out silently.
+// =====================================================================
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr size_t kBlock = 64;
+    constexpr int64_t kStallNs = 50'000;
+    constexpr auto kHangTimeout = std::chrono::seconds(10);
+
+    int64_t elapsedNs(Clock::time_point start) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+    }
+
+    struct AtomicMax {
+        std::atomic<int64_t> value{ 0 };
+
+        void update(int64_t v) {
+            int64_t cur = value.load(std::memory_order_relaxed);
+            while (v > cur && !value.compare_exchange_weak(cur, v, std::memory_order_relaxed)) {}
+        }
+    };
+
+    // Exits the process when `progress` stops moving while armed
+    class Watchdog {
+    public:
+        Watchdog(const std::atomic<uint64_t>& progress, int64_t entities, int64_t threads)
+            : mProgress(progress), mEntities(entities), mThreads(threads), mThread([this] { loop(); }) {}
+
+        ~Watchdog() {
+            {
+                std::lock_guard lock(mMutex);
+                mStop = true;
+            }
+            mWake.notify_all();
+            mThread.join();
+        }
+
+        Watchdog(const Watchdog&) = delete;
+        Watchdog& operator=(const Watchdog&) = delete;
+
+        void arm(bool armed) { mArmed.store(armed, std::memory_order_relaxed); }
+
+    private:
+        void loop() {
+            std::unique_lock lock(mMutex);
+            uint64_t last = mProgress.load(std::memory_order_relaxed);
+            auto lastChange = Clock::now();
+            while (!mStop) {
+                mWake.wait_for(lock, std::chrono::milliseconds(100));
+                const uint64_t cur = mProgress.load(std::memory_order_relaxed);
+                const auto now = Clock::now();
+                if (cur != last || !mArmed.load(std::memory_order_relaxed)) {
+                    last = cur;
+                    lastChange = now;
+                } else if (now - lastChange > kHangTimeout) {
+                    std::fprintf(stderr, "realistic_mt/ecss_ts/async_producer_consumer/%lld/threads:%lld: no progress for %llds, "
+                        "Registry<true> is stuck (atomic wait/notify)\n",
+                        (long long)mEntities, (long long)mThreads, (long long)kHangTimeout.count());
+                    std::fflush(stderr);
+                    std::_Exit(3);
+                }
+            }
+        }
+
+        const std::atomic<uint64_t>& mProgress;
+        const int64_t mEntities;
+        const int64_t mThreads;
+        std::atomic<bool> mArmed{ false };
+        bool mStop = false;
+        std::mutex mMutex;
+        std::condition_variable mWake;
+        std::thread mThread;
+    };
+}
+
+namespace realistic_mt {
+namespace ecss_ts {
+    using Reg = ecss::Registry<true>;
+    using ecss::EntityId;
+
+    struct AsyncWorld {
+        Reg reg;
+        const size_t population;
+        const size_t churn;
+        const size_t readers;
+        std::array<std::vector<EntityId>, 2> batches; // [frame & 1] spawned this frame, the other one despawned
+        uint32_t frame = 0;
+        std::vector<float> readerSums;
+        mt::TaskGraph graph;
+
+        std::atomic<uint64_t> progress{ 0 };
+        std::atomic<int64_t> stallNs{ 0 };
+        std::atomic<uint64_t> stalls{ 0 };
+        std::atomic<int64_t> readerWaitNs{ 0 };
+        AtomicMax maxBlockNs;
+        AtomicMax maxReaderWaitNs;
+
+        AsyncWorld(int n, size_t readerJobs)
+            : population(static_cast<size_t>(n)), churn(static_cast<size_t>(n) / 10), readers(readerJobs), readerSums(readerJobs) {
+            reg.registerArray<Position, Velocity>();
+            batches[0].resize(churn);
+            batches[1].resize(churn);
+            for (size_t i = 0; i < population; ++i) {
+                auto e = reg.takeEntity();
+                reg.addComponent<Position>(e, Position{ (float)i, 0.f, 0.f });
+                reg.addComponent<Velocity>(e, Velocity{ 1.f, 2.f, 3.f });
+                if (i < churn) {
+                    batches[1][i] = e; // despawned by frame 0
+                }
+            }
+
+            graph.add({ .name = "spawn", .items = churn,
+                .run = [this](size_t begin, size_t end) {
+                    auto& out = batches[frame & 1];
+                    for (size_t b = begin; b < end; b += kBlock) {
+                        const auto start = Clock::now();
+                        for (size_t i = b; i < std::min(end, b + kBlock); ++i) {
+                            auto e = reg.takeEntity();
+                            reg.addComponent<Position>(e, Position{ (float)i, 0.f, 0.f });
+                            reg.addComponent<Velocity>(e, Velocity{ 1.f, 2.f, 3.f });
+                            out[i] = e;
+                        }
+                        recordBlock(elapsedNs(start));
+                    }
+                } });
+            graph.add({ .name = "despawn", .items = churn,
+                .run = [this](size_t begin, size_t end) {
+                    const auto& in = batches[(frame + 1) & 1];
+                    std::vector<EntityId> ids;
+                    ids.reserve(kBlock);
+                    for (size_t b = begin; b < end; b += kBlock) {
+                        ids.assign(in.begin() + b, in.begin() + std::min(end, b + kBlock));
+                        const auto start = Clock::now();
+                        reg.destroyEntities(ids);
+                        recordBlock(elapsedNs(start));
+                    }
+                } });
+            for (size_t r = 0; r < readers; ++r) {
+                graph.add({ .name = "reader", .items = 1, .splittable = false,
+                    .run = [this, r](size_t, size_t) {
+                        const auto start = Clock::now();
+                        int64_t wait = -1;
+                        float sum = 0.f;
+                        reg.view<Position, Velocity>().each([&](Position& p, Velocity& v) {
+                            if (wait < 0) {
+                                wait = elapsedNs(start);
+                            }
+                            sum += p.x + p.y + p.z + v.vx + v.vy + v.vz;
+                        });
+                        if (wait < 0) {
+                            wait = elapsedNs(start);
+                        }
+                        readerSums[r] = sum;
+                        readerWaitNs.fetch_add(wait, std::memory_order_relaxed);
+                        maxReaderWaitNs.update(wait);
+                        progress.fetch_add(1, std::memory_order_relaxed);
+                    } });
+            }
+        }
+
+        void recordBlock(int64_t ns) {
+            progress.fetch_add(1, std::memory_order_relaxed);
+            maxBlockNs.update(ns);
+            if (ns > kStallNs) {
+                stalls.fetch_add(1, std::memory_order_relaxed);
+                stallNs.fetch_add(ns, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    static void async_producer_consumer(benchmark::State& state) {
+        const int64_t threads = state.range(1);
+        AsyncWorld world(state.range(0), std::max<size_t>(1, static_cast<size_t>(threads) / 2));
+        mt::WorkStealingPool pool(static_cast<size_t>(threads));
+        std::vector<double> durations;
+        Watchdog watchdog(world.progress, state.range(0), threads);
+
+        for (auto _ : state) {
+            watchdog.arm(true);
+            pool.run(world.graph, durations);
+            watchdog.arm(false);
+            benchmark::DoNotOptimize(world.readerSums.data());
+            ++world.frame;
+        }
+
+        const double frames = static_cast<double>(std::max<benchmark::IterationCount>(1, state.iterations()));
+        const double spawned = static_cast<double>(state.iterations()) * static_cast<double>(world.churn);
+        const double iterated = static_cast<double>(state.iterations()) * static_cast<double>(world.readers * world.population);
+        state.counters["spawned_per_second"] = benchmark::Counter(spawned, benchmark::Counter::kIsRate);
+        state.counters["iterated_per_second"] = benchmark::Counter(iterated, benchmark::Counter::kIsRate);
+        state.counters["producer_stall_us"] = static_cast<double>(world.stallNs.load()) / frames / 1000.0;
+        state.counters["producer_stalls"] = static_cast<double>(world.stalls.load()) / frames;
+        state.counters["max_block_us"] = static_cast<double>(world.maxBlockNs.value.load()) / 1000.0;
+        state.counters["reader_wait_us"] = static_cast<double>(world.readerWaitNs.load()) / (frames * static_cast<double>(world.readers)) / 1000.0;
+        state.counters["max_reader_wait_us"] = static_cast<double>(world.maxReaderWaitNs.value.load()) / 1000.0;
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(world.churn * 2 + world.readers * world.population));
+    }
+} // namespace ecss_ts
+} // namespace realistic_mt
+
+// realistic_mt/ecss_ts/async_producer_consumer/<entities>/threads:<N>; real time (work runs on the pool)
+BENCHMARK(realistic_mt::ecss_ts::async_producer_consumer)->Name("realistic_mt/ecss_ts/async_producer_consumer")
+    ->Unit(benchmark::TimeUnit::kMicrosecond)->ArgsProduct({{100000, 1000000}, mt::threadCounts()})->ArgNames({"", "threads"})
+    ->UseRealTime()->MinTime(0.3);
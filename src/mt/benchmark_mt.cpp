@@ -0,0 +1,896 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "components.h"
+#include "mt/thread_pool.h"
+#include "sector_slots.h"
+
+// =====================================================================
+// PARALLEL SYSTEM EXECUTION (ecss_benchmarks_mt)
+// Same setups and kernels as the realistic::*_r scenarios, split over N cores.
+// state.range(0) = entities, state.range(1) = threads.
+//
+// ecss: the linear slot range of the (grouped) sector container is split into contiguous chunks,
+//       members are read through the layout offsets (sectors::Slots, no per-entity lookup).
+// entt: owning group, then the aligned packed component arrays are split into contiguous chunks.
+// flecs: built with worker threads, systems are multi_threaded() and run via progress().
+// sprite_batching writes each entity's quad to its own slot of a preallocated draw list, combat_damage
+// rolls crits from a stateless per-(entity, frame) hash; the health reset between frames is untimed.
+// mixed_archetypes runs its two systems one after the other, each split over the pool; the render-prep
+// sum is reduced per chunk. ECSS groups the three components for it, EnTT owns RigidBody and Sprite in
+// two partial-owning groups and fetches Transform from its pool.
+//
+// Not ported, they stay serial in ecss_benchmarks:
+//  collision_broadphase - the sweep carries lastMaxX from one entity to the next in storage order, so a
+//                         split changes the result (full_frame runs it as one non-splittable task)
+//  entity_churn, add_remove_component - structural changes; Registry<false>, entt::registry and flecs
+//                         outside readonly/deferred mode are not safe to mutate from several threads, and
+//                         going through command buffers would measure those instead (concurrent spawning
+//                         is covered by ecss_ts/async_producer_consumer)
+// =====================================================================
+
+namespace {
+    struct BatchVertex { float x, y, u, v; uint32_t color; };
+
+    // Stateless roll in [0, 1), so chunks can run in any order
+    float hitRoll(uint32_t entity, uint32_t frame) {
+        uint32_t h = entity * 0x9E3779B1u ^ frame * 0x85EBCA77u;
+        h ^= h >> 15;
+        h *= 0x2C1B3C6Du;
+        h ^= h >> 12;
+        return (float)(h % 1000) / 1000.f;
+    }
+
+    void emitQuad(BatchVertex* out, const Transform& t, const Sprite& s) {
+        out[0] = { t.x,        t.y,        s.u0, s.v0, s.color };
+        out[1] = { t.x + t.sx, t.y,        s.u1, s.v0, s.color };
+        out[2] = { t.x + t.sx, t.y + t.sy, s.u1, s.v1, s.color };
+        out[3] = { t.x,        t.y + t.sy, s.u0, s.v1, s.color };
+    }
+
+    void applyDamage(Health& h, const Damage& d, float roll) {
+        if (h.isDead) return;
+
+        float finalDamage = d.amount - d.armor * 0.5f;
+        if (finalDamage < 1.f) finalDamage = 1.f;
+        if (roll < d.critChance) {
+            finalDamage *= d.critMultiplier;
+        }
+
+        h.current -= finalDamage;
+        if (h.current <= 0.f) {
+            h.current = 0.f;
+            h.isDead = true;
+        }
+    }
+
+    Transform spriteTransform(int i) {
+        return Transform{ (float)(i % 1920), (float)((i / 1920) % 1080), 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f };
+    }
+
+    Sprite spriteOf(int i) {
+        return Sprite{ (uint32_t)(i % 256), 0.f, 0.f, 1.f, 1.f, 0xFFFFFFFF, i % 10 };
+    }
+
+    Damage damageOf(int i) {
+        return Damage{ 10.f + (float)(i % 20), 5.f + (float)(i % 10), 0.1f + (float)(i % 10) / 100.f, 2.f };
+    }
+
+    Transform mixedTransform(int i) {
+        return Transform{ (float)i, 0.f, 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f };
+    }
+
+    Sprite mixedSprite(int i) {
+        return Sprite{ (uint32_t)(i % 256), 0.f, 0.f, 1.f, 1.f, 0xFFFFFFFF, 0 };
+    }
+
+    RigidBody mixedBody() {
+        return RigidBody{ 1.f, 0.f, 0.f, 0.f, -9.8f, 0.f, 1.f, 0.1f };
+    }
+
+    void moveMixed(Transform& t, RigidBody& rb, float dt) {
+        rb.vy += rb.ay * dt;
+        t.x += rb.vx * dt;
+        t.y += rb.vy * dt;
+    }
+
+    // Element i of T's packed array; an owning group keeps its pools aligned over [0, group.size())
+    template <typename T>
+    T& packedAt(T* const* pages, size_t i) {
+        constexpr size_t page = entt::component_traits<T>::page_size;
+        return pages[i / page][i % page];
+    }
+}
+
+namespace realistic_mt {
+namespace ecss_r {
+    using Reg = ecss::Registry<false>;
+
+    static void physics_integration(benchmark::State& state) {
+        Reg reg;
+        reg.registerArray<Transform, RigidBody>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            reg.addComponent<Transform>(e, Transform{ (float)i, (float)(i * 2), 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f });
+            reg.addComponent<RigidBody>(e, RigidBody{ 1.f, 0.5f, 0.f, 0.f, -9.8f, 0.f, 1.f, 0.1f });
+        }
+
+        const float dt = 1.f / 60.f;
+        const sectors::Slots<Transform, RigidBody> slots(reg);
+        mt::ThreadPool pool(state.range(1));
+
+        for (auto _ : state) {
+            pool.parallelFor(slots.size(), [&](size_t begin, size_t end) {
+                slots.each(begin, end, [dt](size_t, Transform& t, RigidBody& rb) {
+                    rb.vx += rb.ax * dt;
+                    rb.vy += rb.ay * dt;
+                    rb.vz += rb.az * dt;
+                    rb.vx *= (1.f - rb.drag * dt);
+                    rb.vy *= (1.f - rb.drag * dt);
+                    rb.vz *= (1.f - rb.drag * dt);
+                    t.x += rb.vx * dt;
+                    t.y += rb.vy * dt;
+                    t.z += rb.vz * dt;
+                });
+            });
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void health_regen(benchmark::State& state) {
+        Reg reg;
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            reg.addComponent<Health>(e, Health{ 50.f + (float)(i % 50), 100.f, 1.f + (float)(i % 5), false });
+        }
+
+        const float dt = 1.f / 60.f;
+        const sectors::Slots<Health> slots(reg);
+        mt::ThreadPool pool(state.range(1));
+
+        for (auto _ : state) {
+            pool.parallelFor(slots.size(), [&](size_t begin, size_t end) {
+                slots.each(begin, end, [dt](size_t, Health& h) {
+                    if (!h.isDead && h.current < h.max) {
+                        h.current = std::min(h.max, h.current + h.regen * dt);
+                    }
+                });
+            });
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void ai_state_machine(benchmark::State& state) {
+        Reg reg;
+        reg.registerArray<Transform, AIState>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            reg.addComponent<Transform>(e, Transform{ (float)(i % 1000), (float)(i / 1000), 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f });
+            reg.addComponent<AIState>(e, AIState{ i % 4, (float)(i % 60) / 60.f, 100.f, 20.f, 0 });
+        }
+
+        const float playerX = 500.f, playerY = 500.f;
+        const float dt = 1.f / 60.f;
+        const sectors::Slots<Transform, AIState> slots(reg);
+        mt::ThreadPool pool(state.range(1));
+
+        for (auto _ : state) {
+            pool.parallelFor(slots.size(), [&](size_t begin, size_t end) {
+                slots.each(begin, end, [=](size_t, const Transform& t, AIState& ai) {
+                    ai.timer -= dt;
+                    float dx = playerX - t.x;
+                    float dy = playerY - t.y;
+                    float distSq = dx * dx + dy * dy;
+
+                    switch (ai.state) {
+                        case 0:
+                            if (distSq < ai.aggroRange * ai.aggroRange) ai.state = 2;
+                            else if (ai.timer <= 0.f) { ai.state = 1; ai.timer = 3.f; }
+                            break;
+                        case 1:
+                            if (distSq < ai.aggroRange * ai.aggroRange) ai.state = 2;
+                            else if (ai.timer <= 0.f) { ai.state = 0; ai.timer = 2.f; }
+                            break;
+                        case 2:
+                            if (distSq < ai.attackRange * ai.attackRange) { ai.state = 3; ai.timer = 1.f; }
+                            else if (distSq > ai.aggroRange * ai.aggroRange * 1.5f) ai.state = 0;
+                            break;
+                        case 3:
+                            if (ai.timer <= 0.f) ai.state = 2;
+                            break;
+                    }
+                });
+            });
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void particle_system(benchmark::State& state) {
+        Reg reg;
+        reg.registerArray<Position, Velocity>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            float angle = (float)(i % 360) * 3.14159f / 180.f;
+            float speed = 50.f + (float)(i % 100);
+            reg.addComponent<Position>(e, Position{ (float)(i % 100), (float)((i / 100) % 100), 0.f });
+            reg.addComponent<Velocity>(e, Velocity{ std::cos(angle) * speed, std::sin(angle) * speed, 0.f });
+        }
+
+        const float dt = 1.f / 60.f;
+        const sectors::Slots<Position, Velocity> slots(reg);
+        mt::ThreadPool pool(state.range(1));
+
+        for (auto _ : state) {
+            pool.parallelFor(slots.size(), [&](size_t begin, size_t end) {
+                slots.each(begin, end, [dt](size_t, Position& p, Velocity& v) {
+                    v.vy -= 98.f * dt;
+                    p.x += v.vx * dt;
+                    p.y += v.vy * dt;
+                    p.z += v.vz * dt;
+                    v.vx *= 0.99f;
+                    v.vy *= 0.99f;
+                    v.vz *= 0.99f;
+                });
+            });
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void sprite_batching(benchmark::State& state) {
+        Reg reg;
+        reg.registerArray<Transform, Sprite>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            reg.addComponent<Transform>(e, spriteTransform(i));
+            reg.addComponent<Sprite>(e, spriteOf(i));
+        }
+
+        const sectors::Slots<Transform, Sprite> slots(reg);
+        std::vector<BatchVertex> batch(slots.size() * 4);
+        mt::ThreadPool pool(state.range(1));
+
+        for (auto _ : state) {
+            pool.parallelFor(slots.size(), [&](size_t begin, size_t end) {
+                slots.each(begin, end, [&batch](size_t slot, const Transform& t, const Sprite& s) {
+                    emitQuad(&batch[slot * 4], t, s);
+                });
+            });
+            benchmark::DoNotOptimize(batch.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void combat_damage(benchmark::State& state) {
+        Reg reg;
+        reg.registerArray<Health, Damage>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            reg.addComponent<Health>(e, Health{ 100.f, 100.f, 0.f, false });
+            reg.addComponent<Damage>(e, damageOf(i));
+        }
+
+        const sectors::Slots<Health, Damage> slots(reg);
+        mt::ThreadPool pool(state.range(1));
+        uint32_t frame = 0;
+
+        for (auto _ : state) {
+            ++frame;
+            pool.parallelFor(slots.size(), [&](size_t begin, size_t end) {
+                slots.each(begin, end, [frame](size_t slot, Health& h, const Damage& d) {
+                    applyDamage(h, d, hitRoll(static_cast<uint32_t>(slot), frame));
+                });
+            });
+            benchmark::ClobberMemory();
+
+            state.PauseTiming();
+            slots.each(0, slots.size(), [](size_t, Health& h, const Damage&) {
+                h.current = h.max;
+                h.isDead = false;
+            });
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    // Transform, Sprite and RigidBody grouped into one container so both systems walk slot ranges;
+    // slots without the system's second component are skipped by their alive bits
+    static void mixed_archetypes(benchmark::State& state) {
+        Reg reg;
+        reg.registerArray<Transform, Sprite, RigidBody>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            const int type = i % 10;
+            reg.addComponent<Transform>(e, mixedTransform(i));
+            if (type >= 4) reg.addComponent<Sprite>(e, mixedSprite(i));
+            if (type >= 7 || type < 2) reg.addComponent<RigidBody>(e, mixedBody());
+        }
+
+        const float dt = 1.f / 60.f;
+        const sectors::Slots<Transform, RigidBody> bodies(reg);
+        const sectors::Slots<Transform, Sprite> sprites(reg);
+        mt::ThreadPool pool(state.range(1));
+
+        for (auto _ : state) {
+            pool.parallelFor(bodies.size(), [&](size_t begin, size_t end) {
+                bodies.each(begin, end, [dt](size_t, Transform& t, RigidBody& rb) { moveMixed(t, rb, dt); });
+            });
+
+            std::atomic<float> accum{ 0.f };
+            pool.parallelFor(sprites.size(), [&](size_t begin, size_t end) {
+                float local = 0.f;
+                sprites.each(begin, end, [&local](size_t, const Transform& t, const Sprite& s) { local += t.x * (float)s.layer; });
+                accum.fetch_add(local, std::memory_order_relaxed);
+            });
+            benchmark::DoNotOptimize(accum.load(std::memory_order_relaxed));
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+} // namespace ecss_r
+
+namespace entt_r {
+    using big_registry = entt::registry;
+
+    static void physics_integration(benchmark::State& state) {
+        big_registry reg;
+        auto group = reg.group<Transform, RigidBody>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.create();
+            reg.emplace<Transform>(e, Transform{ (float)i, (float)(i * 2), 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f });
+            reg.emplace<RigidBody>(e, RigidBody{ 1.f, 0.5f, 0.f, 0.f, -9.8f, 0.f, 1.f, 0.1f });
+        }
+
+        const float dt = 1.f / 60.f;
+        Transform* const* transforms = reg.storage<Transform>().raw();
+        RigidBody* const* bodies = reg.storage<RigidBody>().raw();
+        mt::ThreadPool pool(state.range(1));
+
+        for (auto _ : state) {
+            pool.parallelFor(group.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    auto& t = packedAt(transforms, i);
+                    auto& rb = packedAt(bodies, i);
+                    rb.vx += rb.ax * dt;
+                    rb.vy += rb.ay * dt;
+                    rb.vz += rb.az * dt;
+                    rb.vx *= (1.f - rb.drag * dt);
+                    rb.vy *= (1.f - rb.drag * dt);
+                    rb.vz *= (1.f - rb.drag * dt);
+                    t.x += rb.vx * dt;
+                    t.y += rb.vy * dt;
+                    t.z += rb.vz * dt;
+                }
+            });
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void health_regen(benchmark::State& state) {
+        big_registry reg;
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.create();
+            reg.emplace<Health>(e, Health{ 50.f + (float)(i % 50), 100.f, 1.f + (float)(i % 5), false });
+        }
+
+        const float dt = 1.f / 60.f;
+        auto& storage = reg.storage<Health>();
+        Health* const* healths = storage.raw();
+        mt::ThreadPool pool(state.range(1));
+
+        for (auto _ : state) {
+            pool.parallelFor(storage.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    auto& h = packedAt(healths, i);
+                    if (!h.isDead && h.current < h.max) {
+                        h.current = std::min(h.max, h.current + h.regen * dt);
+                    }
+                }
+            });
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void ai_state_machine(benchmark::State& state) {
+        big_registry reg;
+        auto group = reg.group<Transform, AIState>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.create();
+            reg.emplace<Transform>(e, Transform{ (float)(i % 1000), (float)(i / 1000), 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f });
+            reg.emplace<AIState>(e, AIState{ i % 4, (float)(i % 60) / 60.f, 100.f, 20.f, 0 });
+        }
+
+        const float playerX = 500.f, playerY = 500.f;
+        const float dt = 1.f / 60.f;
+        Transform* const* transforms = reg.storage<Transform>().raw();
+        AIState* const* ais = reg.storage<AIState>().raw();
+        mt::ThreadPool pool(state.range(1));
+
+        for (auto _ : state) {
+            pool.parallelFor(group.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    const auto& t = packedAt(transforms, i);
+                    auto& ai = packedAt(ais, i);
+                    ai.timer -= dt;
+                    float dx = playerX - t.x;
+                    float dy = playerY - t.y;
+                    float distSq = dx * dx + dy * dy;
+
+                    switch (ai.state) {
+                        case 0:
+                            if (distSq < ai.aggroRange * ai.aggroRange) ai.state = 2;
+                            else if (ai.timer <= 0.f) { ai.state = 1; ai.timer = 3.f; }
+                            break;
+                        case 1:
+                            if (distSq < ai.aggroRange * ai.aggroRange) ai.state = 2;
+                            else if (ai.timer <= 0.f) { ai.state = 0; ai.timer = 2.f; }
+                            break;
+                        case 2:
+                            if (distSq < ai.attackRange * ai.attackRange) { ai.state = 3; ai.timer = 1.f; }
+                            else if (distSq > ai.aggroRange * ai.aggroRange * 1.5f) ai.state = 0;
+                            break;
+                        case 3:
+                            if (ai.timer <= 0.f) ai.state = 2;
+                            break;
+                    }
+                }
+            });
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void particle_system(benchmark::State& state) {
+        big_registry reg;
+        auto group = reg.group<Position, Velocity>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.create();
+            float angle = (float)(i % 360) * 3.14159f / 180.f;
+            float speed = 50.f + (float)(i % 100);
+            reg.emplace<Position>(e, Position{ (float)(i % 100), (float)((i / 100) % 100), 0.f });
+            reg.emplace<Velocity>(e, Velocity{ std::cos(angle) * speed, std::sin(angle) * speed, 0.f });
+        }
+
+        const float dt = 1.f / 60.f;
+        Position* const* positions = reg.storage<Position>().raw();
+        Velocity* const* velocities = reg.storage<Velocity>().raw();
+        mt::ThreadPool pool(state.range(1));
+
+        for (auto _ : state) {
+            pool.parallelFor(group.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    auto& p = packedAt(positions, i);
+                    auto& v = packedAt(velocities, i);
+                    v.vy -= 98.f * dt;
+                    p.x += v.vx * dt;
+                    p.y += v.vy * dt;
+                    p.z += v.vz * dt;
+                    v.vx *= 0.99f;
+                    v.vy *= 0.99f;
+                    v.vz *= 0.99f;
+                }
+            });
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void sprite_batching(benchmark::State& state) {
+        big_registry reg;
+        auto group = reg.group<Transform, Sprite>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.create();
+            reg.emplace<Transform>(e, spriteTransform(i));
+            reg.emplace<Sprite>(e, spriteOf(i));
+        }
+
+        Transform* const* transforms = reg.storage<Transform>().raw();
+        Sprite* const* sprites = reg.storage<Sprite>().raw();
+        std::vector<BatchVertex> batch(group.size() * 4);
+        mt::ThreadPool pool(state.range(1));
+
+        for (auto _ : state) {
+            pool.parallelFor(group.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    emitQuad(&batch[i * 4], packedAt(transforms, i), packedAt(sprites, i));
+                }
+            });
+            benchmark::DoNotOptimize(batch.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void combat_damage(benchmark::State& state) {
+        big_registry reg;
+        auto group = reg.group<Health, Damage>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.create();
+            reg.emplace<Health>(e, Health{ 100.f, 100.f, 0.f, false });
+            reg.emplace<Damage>(e, damageOf(i));
+        }
+
+        Health* const* healths = reg.storage<Health>().raw();
+        Damage* const* damages = reg.storage<Damage>().raw();
+        mt::ThreadPool pool(state.range(1));
+        uint32_t frame = 0;
+
+        for (auto _ : state) {
+            ++frame;
+            pool.parallelFor(group.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    applyDamage(packedAt(healths, i), packedAt(damages, i), hitRoll(static_cast<uint32_t>(i), frame));
+                }
+            });
+            benchmark::ClobberMemory();
+
+            state.PauseTiming();
+            for (size_t i = 0; i < group.size(); ++i) {
+                auto& h = packedAt(healths, i);
+                h.current = h.max;
+                h.isDead = false;
+            }
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    // A Transform pool cannot be aligned with both RigidBody and Sprite: each system owns its second
+    // component in a partial-owning group, chunks that packed array and fetches Transform from its pool
+    static void mixed_archetypes(benchmark::State& state) {
+        big_registry reg;
+        auto bodyGroup = reg.group<RigidBody>(entt::get<Transform>);
+        auto spriteGroup = reg.group<Sprite>(entt::get<Transform>);
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.create();
+            const int type = i % 10;
+            reg.emplace<Transform>(e, mixedTransform(i));
+            if (type >= 4) reg.emplace<Sprite>(e, mixedSprite(i));
+            if (type >= 7 || type < 2) reg.emplace<RigidBody>(e, mixedBody());
+        }
+
+        const float dt = 1.f / 60.f;
+        auto& transforms = reg.storage<Transform>();
+        const auto& bodyStorage = reg.storage<RigidBody>();
+        const auto& spriteStorage = reg.storage<Sprite>();
+        RigidBody* const* bodies = bodyStorage.raw();
+        Sprite* const* sprites = spriteStorage.raw();
+        mt::ThreadPool pool(state.range(1));
+
+        for (auto _ : state) {
+            pool.parallelFor(bodyGroup.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    moveMixed(transforms.get(bodyStorage.data()[i]), packedAt(bodies, i), dt);
+                }
+            });
+
+            std::atomic<float> accum{ 0.f };
+            pool.parallelFor(spriteGroup.size(), [&](size_t begin, size_t end) {
+                float local = 0.f;
+                for (size_t i = begin; i < end; ++i) {
+                    local += transforms.get(spriteStorage.data()[i]).x * (float)packedAt(sprites, i).layer;
+                }
+                accum.fetch_add(local, std::memory_order_relaxed);
+            });
+            benchmark::DoNotOptimize(accum.load(std::memory_order_relaxed));
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+} // namespace entt_r
+
+namespace flecs_r {
+    using flecs_world = flecs::world;
+
+    // Worker threads are only spawned for N > 1 so the single-thread row has no pipeline sync cost
+    static void setThreads(flecs_world& world, benchmark::State& state) {
+        if (state.range(1) > 1) {
+            world.set_threads(static_cast<int32_t>(state.range(1)));
+        }
+    }
+
+    static void physics_integration(benchmark::State& state) {
+        flecs_world world;
+        world.component<Transform>();
+        world.component<RigidBody>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            world.entity()
+                .set<Transform>({(float)i, (float)(i * 2), 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f})
+                .set<RigidBody>({1.f, 0.5f, 0.f, 0.f, -9.8f, 0.f, 1.f, 0.1f});
+        }
+
+        const float dt = 1.f / 60.f;
+        world.system<Transform, RigidBody>().multi_threaded().each([dt](Transform& t, RigidBody& rb) {
+            rb.vx += rb.ax * dt;
+            rb.vy += rb.ay * dt;
+            rb.vz += rb.az * dt;
+            rb.vx *= (1.f - rb.drag * dt);
+            rb.vy *= (1.f - rb.drag * dt);
+            rb.vz *= (1.f - rb.drag * dt);
+            t.x += rb.vx * dt;
+            t.y += rb.vy * dt;
+            t.z += rb.vz * dt;
+        });
+        setThreads(world, state);
+
+        for (auto _ : state) {
+            world.progress(dt);
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void health_regen(benchmark::State& state) {
+        flecs_world world;
+        world.component<Health>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            world.entity().set<Health>({50.f + (float)(i % 50), 100.f, 1.f + (float)(i % 5), false});
+        }
+
+        const float dt = 1.f / 60.f;
+        world.system<Health>().multi_threaded().each([dt](Health& h) {
+            if (!h.isDead && h.current < h.max) {
+                h.current = std::min(h.max, h.current + h.regen * dt);
+            }
+        });
+        setThreads(world, state);
+
+        for (auto _ : state) {
+            world.progress(dt);
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void ai_state_machine(benchmark::State& state) {
+        flecs_world world;
+        world.component<Transform>();
+        world.component<AIState>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            world.entity()
+                .set<Transform>({(float)(i % 1000), (float)(i / 1000), 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f})
+                .set<AIState>({i % 4, (float)(i % 60) / 60.f, 100.f, 20.f, 0});
+        }
+
+        const float playerX = 500.f, playerY = 500.f;
+        const float dt = 1.f / 60.f;
+        world.system<const Transform, AIState>().multi_threaded().each([=](const Transform& t, AIState& ai) {
+            ai.timer -= dt;
+            float dx = playerX - t.x;
+            float dy = playerY - t.y;
+            float distSq = dx * dx + dy * dy;
+
+            switch (ai.state) {
+                case 0:
+                    if (distSq < ai.aggroRange * ai.aggroRange) ai.state = 2;
+                    else if (ai.timer <= 0.f) { ai.state = 1; ai.timer = 3.f; }
+                    break;
+                case 1:
+                    if (distSq < ai.aggroRange * ai.aggroRange) ai.state = 2;
+                    else if (ai.timer <= 0.f) { ai.state = 0; ai.timer = 2.f; }
+                    break;
+                case 2:
+                    if (distSq < ai.attackRange * ai.attackRange) { ai.state = 3; ai.timer = 1.f; }
+                    else if (distSq > ai.aggroRange * ai.aggroRange * 1.5f) ai.state = 0;
+                    break;
+                case 3:
+                    if (ai.timer <= 0.f) ai.state = 2;
+                    break;
+            }
+        });
+        setThreads(world, state);
+
+        for (auto _ : state) {
+            world.progress(dt);
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void particle_system(benchmark::State& state) {
+        flecs_world world;
+        world.component<Position>();
+        world.component<Velocity>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            float angle = (float)(i % 360) * 3.14159f / 180.f;
+            float speed = 50.f + (float)(i % 100);
+            world.entity()
+                .set<Position>({(float)(i % 100), (float)((i / 100) % 100), 0.f})
+                .set<Velocity>({std::cos(angle) * speed, std::sin(angle) * speed, 0.f});
+        }
+
+        const float dt = 1.f / 60.f;
+        world.system<Position, Velocity>().multi_threaded().each([dt](Position& p, Velocity& v) {
+            v.vy -= 98.f * dt;
+            p.x += v.vx * dt;
+            p.y += v.vy * dt;
+            p.z += v.vz * dt;
+            v.vx *= 0.99f;
+            v.vy *= 0.99f;
+            v.vz *= 0.99f;
+        });
+        setThreads(world, state);
+
+        for (auto _ : state) {
+            world.progress(dt);
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void sprite_batching(benchmark::State& state) {
+        flecs_world world;
+        world.component<Transform>();
+        world.component<Sprite>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            world.entity().set<Transform>(spriteTransform(i)).set<Sprite>(spriteOf(i));
+        }
+
+        // Each table claims a contiguous run of the draw list; workers share the cursor
+        std::vector<BatchVertex> batch(static_cast<size_t>(n) * 4);
+        std::atomic<size_t> cursor{ 0 };
+        world.system<const Transform, const Sprite>().multi_threaded().run([&](flecs::iter& it) {
+            while (it.next()) {
+                auto t = it.field<const Transform>(0);
+                auto s = it.field<const Sprite>(1);
+                BatchVertex* out = &batch[cursor.fetch_add(it.count() * 4, std::memory_order_relaxed)];
+                for (auto i : it) {
+                    emitQuad(out + i * 4, t[i], s[i]);
+                }
+            }
+        });
+        setThreads(world, state);
+
+        for (auto _ : state) {
+            cursor.store(0, std::memory_order_relaxed);
+            world.progress();
+            benchmark::DoNotOptimize(batch.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void combat_damage(benchmark::State& state) {
+        flecs_world world;
+        world.component<Health>();
+        world.component<Damage>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            world.entity().set<Health>({100.f, 100.f, 0.f, false}).set<Damage>(damageOf(i));
+        }
+
+        uint32_t frame = 0;
+        world.system<Health, const Damage>().multi_threaded().each([&frame](flecs::entity e, Health& h, const Damage& d) {
+            applyDamage(h, d, hitRoll(static_cast<uint32_t>(e.id()), frame));
+        });
+        auto reset = world.query<Health>();
+        setThreads(world, state);
+
+        for (auto _ : state) {
+            ++frame;
+            world.progress();
+            benchmark::ClobberMemory();
+
+            state.PauseTiming();
+            reset.each([](Health& h) {
+                h.current = h.max;
+                h.isDead = false;
+            });
+            state.ResumeTiming();
+        }
+        reset.destruct();
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    static void mixed_archetypes(benchmark::State& state) {
+        flecs_world world;
+        world.component<Transform>();
+        world.component<Sprite>();
+        world.component<RigidBody>();
+        const int n = state.range(0);
+
+        for (int i = 0; i < n; ++i) {
+            auto e = world.entity().set<Transform>(mixedTransform(i));
+            const int type = i % 10;
+            if (type >= 4) e.set<Sprite>(mixedSprite(i));
+            if (type >= 7 || type < 2) e.set<RigidBody>(mixedBody());
+        }
+
+        const float dt = 1.f / 60.f;
+        std::atomic<float> accum{ 0.f };
+        world.system<Transform, RigidBody>().multi_threaded().each([dt](Transform& t, RigidBody& rb) { moveMixed(t, rb, dt); });
+        world.system<const Transform, const Sprite>().multi_threaded().run([&accum](flecs::iter& it) {
+            float local = 0.f;
+            while (it.next()) {
+                auto t = it.field<const Transform>(0);
+                auto s = it.field<const Sprite>(1);
+                for (auto i : it) {
+                    local += t[i].x * (float)s[i].layer;
+                }
+            }
+            accum.fetch_add(local, std::memory_order_relaxed);
+        });
+        setThreads(world, state);
+
+        for (auto _ : state) {
+            accum.store(0.f, std::memory_order_relaxed);
+            world.progress(dt);
+            benchmark::DoNotOptimize(accum.load(std::memory_order_relaxed));
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+} // namespace flecs_r
+} // namespace realistic_mt
+
+// Register parallel benchmarks: realistic_mt/<ecs>/<func>/<entities>/threads:<N>
+// Real time, because the workers' CPU time is not charged to the main thread
+#define BENCH_MT_ONE(ECS, FUNC) \
+    BENCHMARK(realistic_mt::ECS::FUNC)->Name("realistic_mt/" #ECS "/" #FUNC)->Unit(benchmark::TimeUnit::kMicrosecond) \
+        ->ArgsProduct({{100000, 1000000}, mt::threadCounts()})->ArgNames({"", "threads"})->UseRealTime()->MinTime(0.3);
+
+#define REGISTER_MT(ecs1, ecs2, ecs3, FUNC) \
+    BENCH_MT_ONE(ecs1, FUNC) \
+    BENCH_MT_ONE(ecs2, FUNC) \
+    BENCH_MT_ONE(ecs3, FUNC)
+
+REGISTER_MT(ecss_r, entt_r, flecs_r, physics_integration)
+REGISTER_MT(ecss_r, entt_r, flecs_r, health_regen)
+REGISTER_MT(ecss_r, entt_r, flecs_r, ai_state_machine)
+REGISTER_MT(ecss_r, entt_r, flecs_r, particle_system)
+REGISTER_MT(ecss_r, entt_r, flecs_r, sprite_batching)
+REGISTER_MT(ecss_r, entt_r, flecs_r, combat_damage)
+REGISTER_MT(ecss_r, entt_r, flecs_r, mixed_archetypes)
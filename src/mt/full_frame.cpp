@@ -0,0 +1,537 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "components.h"
+#include "mt/task_graph.h"
+#include "mt/thread_pool.h"
+#include "sector_slots.h"
+
+// =====================================================================
+// FULL FRAME (ecss_benchmarks_mt)
+// Six realistic systems chained over one shared world, in frame order:
+//   physics_integration   R RigidBody            W Transform, RigidBody
+//   ai_state_machine      R Transform            W AIState
+//   combat_damage         R Damage               W Health
+//   health_regen                                 W Health (dead actors respawn)
+//   collision_broadphase  R Transform            W AABB, contacts (serial sweep)
+//   sprite_batching       R Transform, Sprite    W draw list
+// Every entity is a moving sprite with bounds, every second one is also an actor (AIState, Health, Damage).
+//
+// full_frame_serial - the systems one after another on the calling thread
+// full_frame        - ecss/entt: mt::TaskGraph derived from the access sets on mt::WorkStealingPool
+//                     (physics -> {ai, collision, sprites} and combat -> regen run side by side, splittable
+//                     systems are chunked); flecs: its own pipeline with worker threads, for comparison
+// critical_path_us - longest dependency chain of the graph with the per-system wall times of that run
+// =====================================================================
+
+namespace {
+    enum FrameAccess : mt::AccessMask {
+        kTransform = 1 << 0,
+        kRigidBody = 1 << 1,
+        kAIState   = 1 << 2,
+        kHealth    = 1 << 3,
+        kDamage    = 1 << 4,
+        kAABB      = 1 << 5,
+        kSprite    = 1 << 6,
+        kContacts  = 1 << 7,
+        kDrawList  = 1 << 8,
+    };
+
+    enum FrameSystem : size_t {
+        kPhysics,
+        kAI,
+        kCombat,
+        kRegen,
+        kCollision,
+        kSprites,
+        kSystemCount
+    };
+
+    constexpr float kDt = 1.f / 60.f;
+    constexpr float kPlayerX = 500.f, kPlayerY = 500.f;
+
+    struct BatchVertex { float x, y, u, v; uint32_t color; };
+
+    bool isActor(int i) { return i % 2 == 0; }
+
+    Transform frameTransform(int i) {
+        return Transform{ (float)(i % 100) * 10.f, (float)((i / 100) % 100) * 10.f, (float)(i / 10000) * 10.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f };
+    }
+
+    RigidBody frameBody() {
+        return RigidBody{ 1.f, 0.5f, 0.f, 0.f, -9.8f, 0.f, 1.f, 0.1f };
+    }
+
+    AABB boundsOf(const Transform& t) {
+        return AABB{ t.x - 1.f, t.y - 1.f, t.z - 1.f, t.x + 1.f, t.y + 1.f, t.z + 1.f };
+    }
+
+    Sprite frameSprite(int i) {
+        return Sprite{ (uint32_t)(i % 256), 0.f, 0.f, 1.f, 1.f, 0xFFFFFFFF, i % 10 };
+    }
+
+    AIState frameAI(int i) {
+        return AIState{ i % 4, (float)(i % 60) / 60.f, 100.f, 20.f, 0 };
+    }
+
+    Health frameHealth(int i) {
+        return Health{ 100.f, 100.f, 1.f + (float)(i % 5), false };
+    }
+
+    Damage frameDamage(int i) {
+        return Damage{ 10.f + (float)(i % 20), 5.f + (float)(i % 10), 0.1f + (float)(i % 10) / 100.f, 2.f };
+    }
+
+    void integrateBody(Transform& t, RigidBody& rb) {
+        rb.vx += rb.ax * kDt;
+        rb.vy += rb.ay * kDt;
+        rb.vz += rb.az * kDt;
+        rb.vx *= (1.f - rb.drag * kDt);
+        rb.vy *= (1.f - rb.drag * kDt);
+        rb.vz *= (1.f - rb.drag * kDt);
+        t.x += rb.vx * kDt;
+        t.y += rb.vy * kDt;
+        t.z += rb.vz * kDt;
+    }
+
+    void thinkAI(const Transform& t, AIState& ai) {
+        ai.timer -= kDt;
+        float dx = kPlayerX - t.x;
+        float dy = kPlayerY - t.y;
+        float distSq = dx * dx + dy * dy;
+
+        switch (ai.state) {
+            case 0:
+                if (distSq < ai.aggroRange * ai.aggroRange) ai.state = 2;
+                else if (ai.timer <= 0.f) { ai.state = 1; ai.timer = 3.f; }
+                break;
+            case 1:
+                if (distSq < ai.aggroRange * ai.aggroRange) ai.state = 2;
+                else if (ai.timer <= 0.f) { ai.state = 0; ai.timer = 2.f; }
+                break;
+            case 2:
+                if (distSq < ai.attackRange * ai.attackRange) { ai.state = 3; ai.timer = 1.f; }
+                else if (distSq > ai.aggroRange * ai.aggroRange * 1.5f) ai.state = 0;
+                break;
+            case 3:
+                if (ai.timer <= 0.f) ai.state = 2;
+                break;
+        }
+    }
+
+    // Stateless per-(entity, frame) roll in [0, 1), so chunks can run in any order
+    float hitRoll(uint32_t entity, uint32_t frame) {
+        uint32_t h = entity * 0x9E3779B1u ^ frame * 0x85EBCA77u;
+        h ^= h >> 15;
+        h *= 0x2C1B3C6Du;
+        h ^= h >> 12;
+        return (float)(h % 1000) / 1000.f;
+    }
+
+    void applyDamage(Health& h, const Damage& d, float roll) {
+        if (h.isDead) return;
+
+        float finalDamage = d.amount - d.armor * 0.5f;
+        if (finalDamage < 1.f) finalDamage = 1.f;
+        if (roll < d.critChance) {
+            finalDamage *= d.critMultiplier;
+        }
+
+        h.current -= finalDamage;
+        if (h.current <= 0.f) {
+            h.current = 0.f;
+            h.isDead = true;
+        }
+    }
+
+    void regenerate(Health& h) {
+        if (h.isDead) {
+            h.current = h.max;
+            h.isDead = false;
+        } else if (h.current < h.max) {
+            h.current = std::min(h.max, h.current + h.regen * kDt);
+        }
+    }
+
+    // Refreshes the bounds from the transform and counts overlaps along X (original broadphase sweep)
+    struct Sweep {
+        size_t overlaps = 0;
+        float lastMaxX = -1e9f;
+
+        void push(const Transform& t, AABB& a) {
+            a = boundsOf(t);
+            if (a.minX < lastMaxX) {
+                overlaps++;
+            }
+            lastMaxX = std::max(lastMaxX, a.maxX);
+        }
+    };
+
+    void emitQuad(BatchVertex* out, const Transform& t, const Sprite& s) {
+        out[0] = { t.x,        t.y,        s.u0, s.v0, s.color };
+        out[1] = { t.x + t.sx, t.y,        s.u1, s.v0, s.color };
+        out[2] = { t.x + t.sx, t.y + t.sy, s.u1, s.v1, s.color };
+        out[3] = { t.x,        t.y + t.sy, s.u0, s.v1, s.color };
+    }
+
+    // Serial or scheduled frames over World::graph; World::frame feeds the combat rolls
+    template <typename World>
+    void runFrames(benchmark::State& state, World& world, std::optional<mt::WorkStealingPool>& pool) {
+        std::vector<double> durations;
+        double criticalPath = 0.0;
+        for (auto _ : state) {
+            ++world.frame;
+            if (pool) {
+                pool->run(world.graph, durations);
+            } else {
+                mt::runSerial(world.graph, durations);
+            }
+            criticalPath += world.graph.criticalPath(durations);
+            benchmark::DoNotOptimize(world.contacts);
+            benchmark::ClobberMemory();
+        }
+        const double frames = static_cast<double>(std::max<benchmark::IterationCount>(1, state.iterations()));
+        state.counters["critical_path_us"] = criticalPath / frames / 1000.0;
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+namespace realistic_mt {
+namespace ecss_r {
+    using Reg = ecss::Registry<false>;
+
+    // Systems walk linear slot ranges of one sector container each (sectors::Slots). Everything but
+    // Health/Damage shares one group, so ai_state_machine's Transform + AIState join needs no lookup;
+    // slots of non-actors have no AIState and are skipped. Concurrent systems write different members
+    // of the same sectors, never the same one.
+    struct FrameWorld {
+        Reg reg;
+        std::vector<BatchVertex> drawList;
+        size_t contacts = 0;
+        uint32_t frame = 0;
+        mt::TaskGraph graph;
+
+        explicit FrameWorld(int n) {
+            reg.registerArray<Transform, RigidBody, AABB, Sprite, AIState>();
+            reg.registerArray<Health, Damage>();
+            for (int i = 0; i < n; ++i) {
+                auto e = reg.takeEntity();
+                const Transform t = frameTransform(i);
+                reg.addComponent<Transform>(e, t);
+                reg.addComponent<RigidBody>(e, frameBody());
+                reg.addComponent<AABB>(e, boundsOf(t));
+                reg.addComponent<Sprite>(e, frameSprite(i));
+                if (isActor(i)) {
+                    reg.addComponent<AIState>(e, frameAI(i));
+                    reg.addComponent<Health>(e, frameHealth(i));
+                    reg.addComponent<Damage>(e, frameDamage(i));
+                }
+            }
+            const sectors::Slots<Transform, RigidBody> bodies(reg);
+            const sectors::Slots<Transform, AIState> ais(reg);
+            const sectors::Slots<Health, Damage> combatants(reg);
+            const sectors::Slots<Health> healths(reg);
+            const sectors::Slots<Transform, AABB> bounds(reg);
+            const sectors::Slots<Transform, Sprite> sprites(reg);
+            drawList.resize(sprites.size() * 4);
+
+            graph.add({ .name = "physics_integration", .reads = kRigidBody, .writes = kTransform | kRigidBody, .items = bodies.size(),
+                .run = [bodies](size_t begin, size_t end) {
+                    bodies.each(begin, end, [](size_t, Transform& t, RigidBody& rb) { integrateBody(t, rb); });
+                } });
+            graph.add({ .name = "ai_state_machine", .reads = kTransform, .writes = kAIState, .items = ais.size(),
+                .run = [ais](size_t begin, size_t end) {
+                    ais.each(begin, end, [](size_t, const Transform& t, AIState& ai) { thinkAI(t, ai); });
+                } });
+            graph.add({ .name = "combat_damage", .reads = kDamage, .writes = kHealth, .items = combatants.size(),
+                .run = [this, combatants](size_t begin, size_t end) {
+                    combatants.each(begin, end, [this](size_t slot, Health& h, const Damage& d) {
+                        applyDamage(h, d, hitRoll(static_cast<uint32_t>(slot), frame));
+                    });
+                } });
+            graph.add({ .name = "health_regen", .writes = kHealth, .items = healths.size(),
+                .run = [healths](size_t begin, size_t end) {
+                    healths.each(begin, end, [](size_t, Health& h) { regenerate(h); });
+                } });
+            graph.add({ .name = "collision_broadphase", .reads = kTransform, .writes = kAABB | kContacts, .items = bounds.size(), .splittable = false,
+                .run = [this, bounds](size_t begin, size_t end) {
+                    Sweep sweep;
+                    bounds.each(begin, end, [&sweep](size_t, const Transform& t, AABB& a) { sweep.push(t, a); });
+                    contacts = sweep.overlaps;
+                } });
+            graph.add({ .name = "sprite_batching", .reads = kTransform | kSprite, .writes = kDrawList, .items = sprites.size(),
+                .run = [this, sprites](size_t begin, size_t end) {
+                    sprites.each(begin, end, [this](size_t slot, const Transform& t, const Sprite& s) { emitQuad(&drawList[slot * 4], t, s); });
+                } });
+        }
+    };
+
+    static void full_frame_serial(benchmark::State& state) {
+        FrameWorld world(state.range(0));
+        std::optional<mt::WorkStealingPool> pool;
+        runFrames(state, world, pool);
+    }
+
+    static void full_frame(benchmark::State& state) {
+        FrameWorld world(state.range(0));
+        std::optional<mt::WorkStealingPool> pool(std::in_place, state.range(1));
+        runFrames(state, world, pool);
+    }
+} // namespace ecss_r
+
+namespace entt_r {
+    // Systems walk the packed entity array of their lead storage (RigidBody for everyone, AIState for actors)
+    struct FrameWorld {
+        entt::registry reg;
+        std::vector<BatchVertex> drawList;
+        size_t contacts = 0;
+        uint32_t frame = 0;
+        mt::TaskGraph graph;
+
+        explicit FrameWorld(int n) {
+            for (int i = 0; i < n; ++i) {
+                auto e = reg.create();
+                const Transform t = frameTransform(i);
+                reg.emplace<Transform>(e, t);
+                reg.emplace<RigidBody>(e, frameBody());
+                reg.emplace<AABB>(e, boundsOf(t));
+                reg.emplace<Sprite>(e, frameSprite(i));
+                if (isActor(i)) {
+                    reg.emplace<AIState>(e, frameAI(i));
+                    reg.emplace<Health>(e, frameHealth(i));
+                    reg.emplace<Damage>(e, frameDamage(i));
+                }
+            }
+            auto& transforms = reg.storage<Transform>();
+            auto& bodies = reg.storage<RigidBody>();
+            auto& ais = reg.storage<AIState>();
+            auto& healths = reg.storage<Health>();
+            auto& damages = reg.storage<Damage>();
+            auto& bounds = reg.storage<AABB>();
+            auto& sprites = reg.storage<Sprite>();
+            drawList.resize(sprites.size() * 4);
+
+            graph.add({ .name = "physics_integration", .reads = kRigidBody, .writes = kTransform | kRigidBody, .items = bodies.size(),
+                .run = [&transforms, &bodies](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        const auto e = bodies.data()[i];
+                        integrateBody(transforms.get(e), bodies.get(e));
+                    }
+                } });
+            graph.add({ .name = "ai_state_machine", .reads = kTransform, .writes = kAIState, .items = ais.size(),
+                .run = [&transforms, &ais](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        const auto e = ais.data()[i];
+                        thinkAI(transforms.get(e), ais.get(e));
+                    }
+                } });
+            graph.add({ .name = "combat_damage", .reads = kDamage, .writes = kHealth, .items = healths.size(),
+                .run = [this, &healths, &damages](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        const auto e = healths.data()[i];
+                        applyDamage(healths.get(e), damages.get(e), hitRoll(static_cast<uint32_t>(entt::to_integral(e)), frame));
+                    }
+                } });
+            graph.add({ .name = "health_regen", .writes = kHealth, .items = healths.size(),
+                .run = [&healths](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        regenerate(healths.get(healths.data()[i]));
+                    }
+                } });
+            graph.add({ .name = "collision_broadphase", .reads = kTransform, .writes = kAABB | kContacts, .items = bounds.size(), .splittable = false,
+                .run = [this, &transforms, &bounds](size_t begin, size_t end) {
+                    Sweep sweep;
+                    for (size_t i = begin; i < end; ++i) {
+                        const auto e = bounds.data()[i];
+                        sweep.push(transforms.get(e), bounds.get(e));
+                    }
+                    contacts = sweep.overlaps;
+                } });
+            graph.add({ .name = "sprite_batching", .reads = kTransform | kSprite, .writes = kDrawList, .items = sprites.size(),
+                .run = [this, &transforms, &sprites](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        const auto e = sprites.data()[i];
+                        emitQuad(&drawList[i * 4], transforms.get(e), sprites.get(e));
+                    }
+                } });
+        }
+    };
+
+    static void full_frame_serial(benchmark::State& state) {
+        FrameWorld world(state.range(0));
+        std::optional<mt::WorkStealingPool> pool;
+        runFrames(state, world, pool);
+    }
+
+    static void full_frame(benchmark::State& state) {
+        FrameWorld world(state.range(0));
+        std::optional<mt::WorkStealingPool> pool(std::in_place, state.range(1));
+        runFrames(state, world, pool);
+    }
+} // namespace entt_r
+
+namespace flecs_r {
+    // The same six systems in a flecs pipeline; splittable ones are multi_threaded(), the sweep stays on
+    // the main thread. flecs runs the systems in declaration order, the TaskGraph is only used to
+    // compute the critical path from the spans the systems record.
+    struct FrameWorld {
+        flecs::world world;
+        std::vector<BatchVertex> drawList;
+        std::atomic<size_t> drawCursor{ 0 };
+        size_t contacts = 0;
+        uint32_t frame = 0;
+        mt::TaskGraph graph;
+        mt::SpanRecorder spans;
+
+        explicit FrameWorld(int n) {
+            world.component<Transform>();
+            world.component<RigidBody>();
+            world.component<AABB>();
+            world.component<Sprite>();
+            world.component<AIState>();
+            world.component<Health>();
+            world.component<Damage>();
+            for (int i = 0; i < n; ++i) {
+                const Transform t = frameTransform(i);
+                auto e = world.entity()
+                    .set<Transform>(t)
+                    .set<RigidBody>(frameBody())
+                    .set<AABB>(boundsOf(t))
+                    .set<Sprite>(frameSprite(i));
+                if (isActor(i)) {
+                    e.set<AIState>(frameAI(i)).set<Health>(frameHealth(i)).set<Damage>(frameDamage(i));
+                }
+            }
+            drawList.resize(static_cast<size_t>(n) * 4);
+
+            world.system<Transform, RigidBody>("physics_integration").multi_threaded().run([this](flecs::iter& it) {
+                const int64_t start = spans.now();
+                while (it.next()) {
+                    auto t = it.field<Transform>(0);
+                    auto rb = it.field<RigidBody>(1);
+                    for (auto i : it) {
+                        integrateBody(t[i], rb[i]);
+                    }
+                }
+                spans.record(kPhysics, start, spans.now());
+            });
+            world.system<const Transform, AIState>("ai_state_machine").multi_threaded().run([this](flecs::iter& it) {
+                const int64_t start = spans.now();
+                while (it.next()) {
+                    auto t = it.field<const Transform>(0);
+                    auto ai = it.field<AIState>(1);
+                    for (auto i : it) {
+                        thinkAI(t[i], ai[i]);
+                    }
+                }
+                spans.record(kAI, start, spans.now());
+            });
+            world.system<Health, const Damage>("combat_damage").multi_threaded().run([this](flecs::iter& it) {
+                const int64_t start = spans.now();
+                while (it.next()) {
+                    auto h = it.field<Health>(0);
+                    auto d = it.field<const Damage>(1);
+                    for (auto i : it) {
+                        applyDamage(h[i], d[i], hitRoll(static_cast<uint32_t>(it.entity(i).id()), frame));
+                    }
+                }
+                spans.record(kCombat, start, spans.now());
+            });
+            world.system<Health>("health_regen").multi_threaded().run([this](flecs::iter& it) {
+                const int64_t start = spans.now();
+                while (it.next()) {
+                    auto h = it.field<Health>(0);
+                    for (auto i : it) {
+                        regenerate(h[i]);
+                    }
+                }
+                spans.record(kRegen, start, spans.now());
+            });
+            world.system<const Transform, AABB>("collision_broadphase").run([this](flecs::iter& it) {
+                const int64_t start = spans.now();
+                Sweep sweep;
+                while (it.next()) {
+                    auto t = it.field<const Transform>(0);
+                    auto a = it.field<AABB>(1);
+                    for (auto i : it) {
+                        sweep.push(t[i], a[i]);
+                    }
+                }
+                contacts = sweep.overlaps;
+                spans.record(kCollision, start, spans.now());
+            });
+            world.system<const Transform, const Sprite>("sprite_batching").multi_threaded().run([this](flecs::iter& it) {
+                const int64_t start = spans.now();
+                while (it.next()) {
+                    auto t = it.field<const Transform>(0);
+                    auto s = it.field<const Sprite>(1);
+                    BatchVertex* out = &drawList[drawCursor.fetch_add(it.count() * 4, std::memory_order_relaxed)];
+                    for (auto i : it) {
+                        emitQuad(out + i * 4, t[i], s[i]);
+                    }
+                }
+                spans.record(kSprites, start, spans.now());
+            });
+
+            graph.add({ .name = "physics_integration", .reads = kRigidBody, .writes = kTransform | kRigidBody });
+            graph.add({ .name = "ai_state_machine", .reads = kTransform, .writes = kAIState });
+            graph.add({ .name = "combat_damage", .reads = kDamage, .writes = kHealth });
+            graph.add({ .name = "health_regen", .writes = kHealth });
+            graph.add({ .name = "collision_broadphase", .reads = kTransform, .writes = kAABB | kContacts });
+            graph.add({ .name = "sprite_batching", .reads = kTransform | kSprite, .writes = kDrawList });
+        }
+    };
+
+    static void runPipeline(benchmark::State& state, FrameWorld& world) {
+        std::vector<double> durations;
+        double criticalPath = 0.0;
+        for (auto _ : state) {
+            ++world.frame;
+            world.drawCursor.store(0, std::memory_order_relaxed);
+            world.spans.reset(kSystemCount);
+            world.world.progress(kDt);
+            world.spans.collect(durations);
+            criticalPath += world.graph.criticalPath(durations);
+            benchmark::DoNotOptimize(world.contacts);
+            benchmark::ClobberMemory();
+        }
+        const double frames = static_cast<double>(std::max<benchmark::IterationCount>(1, state.iterations()));
+        state.counters["critical_path_us"] = criticalPath / frames / 1000.0;
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    static void full_frame_serial(benchmark::State& state) {
+        FrameWorld world(state.range(0));
+        runPipeline(state, world);
+    }
+
+    static void full_frame(benchmark::State& state) {
+        FrameWorld world(state.range(0));
+        // Worker threads are only spawned for N > 1, as in the other realistic_mt rows
+        if (state.range(1) > 1) {
+            world.world.set_threads(static_cast<int32_t>(state.range(1)));
+        }
+        runPipeline(state, world);
+    }
+} // namespace flecs_r
+} // namespace realistic_mt
+
+// realistic_mt/<ecs>/full_frame_serial/<entities> and realistic_mt/<ecs>/full_frame/<entities>/threads:<N>
+// Real time, because the workers' CPU time is not charged to the main thread
+#define BENCH_FULL_FRAME(ECS) \
+    BENCHMARK(realistic_mt::ECS::full_frame_serial)->Name("realistic_mt/" #ECS "/full_frame_serial")->Unit(benchmark::TimeUnit::kMicrosecond) \
+        ->Arg(100000)->Arg(1000000)->UseRealTime()->MinTime(0.3); \
+    BENCHMARK(realistic_mt::ECS::full_frame)->Name("realistic_mt/" #ECS "/full_frame")->Unit(benchmark::TimeUnit::kMicrosecond) \
+        ->ArgsProduct({{100000, 1000000}, mt::threadCounts()})->ArgNames({"", "threads"})->UseRealTime()->MinTime(0.3);
+
+BENCH_FULL_FRAME(ecss_r)
+BENCH_FULL_FRAME(entt_r)
+BENCH_FULL_FRAME(flecs_r)
@@ -0,0 +1,334 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mt {
+    // Access sets are bitmasks over whatever the frame defines (one bit per component or resource)
+    using AccessMask = uint64_t;
+
+    struct System {
+        const char* name = "";
+        AccessMask reads = 0;
+        AccessMask writes = 0;
+        size_t items = 0;       // run() is called over sub-ranges of [0, items)
+        bool splittable = true; // false: always one chunk (order-dependent loops such as a sweep)
+        std::function<void(size_t, size_t)> run;
+    };
+
+    // Systems in frame order. A system depends on every earlier system it conflicts with (one writes
+    // something the other reads or writes), so any schedule that honors the edges gives the serial result.
+    class TaskGraph {
+    public:
+        size_t add(System system) {
+            const size_t idx = mSystems.size();
+            std::vector<size_t> preds;
+            for (size_t i = 0; i < idx; ++i) {
+                if (conflicts(mSystems[i], system)) {
+                    preds.push_back(i);
+                    mSuccs[i].push_back(idx);
+                }
+            }
+            mSystems.push_back(std::move(system));
+            mPreds.push_back(std::move(preds));
+            mSuccs.emplace_back();
+            return idx;
+        }
+
+        size_t size() const { return mSystems.size(); }
+        const System& operator[](size_t idx) const { return mSystems[idx]; }
+        const std::vector<size_t>& predecessors(size_t idx) const { return mPreds[idx]; }
+        const std::vector<size_t>& successors(size_t idx) const { return mSuccs[idx]; }
+
+        // Longest dependency chain with the given per-system durations (any unit)
+        double criticalPath(const std::vector<double>& durations) const {
+            std::vector<double> finish(mSystems.size(), 0.0);
+            double longest = 0.0;
+            for (size_t i = 0; i < mSystems.size(); ++i) {
+                double start = 0.0;
+                for (auto p : mPreds[i]) {
+                    start = std::max(start, finish[p]);
+                }
+                finish[i] = start + durations[i];
+                longest = std::max(longest, finish[i]);
+            }
+            return longest;
+        }
+
+    private:
+        static bool conflicts(const System& a, const System& b) {
+            return (a.writes & (b.reads | b.writes)) != 0 || (b.writes & (a.reads | a.writes)) != 0;
+        }
+
+        std::vector<System> mSystems;
+        std::vector<std::vector<size_t>> mPreds;
+        std::vector<std::vector<size_t>> mSuccs;
+    };
+
+    // First start / last end of every system in a frame, fed concurrently by the pieces that run it
+    class SpanRecorder {
+    public:
+        void reset(size_t systems) {
+            if (mSpans.size() != systems) {
+                mSpans = std::vector<Span>(systems);
+            }
+            for (auto& span : mSpans) {
+                span.start.store(std::numeric_limits<int64_t>::max(), std::memory_order_relaxed);
+                span.end.store(0, std::memory_order_relaxed);
+            }
+            mOrigin = Clock::now();
+        }
+
+        // ns since reset()
+        int64_t now() const {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - mOrigin).count();
+        }
+
+        void record(size_t system, int64_t start, int64_t end) {
+            auto& span = mSpans[system];
+            int64_t cur = span.start.load(std::memory_order_relaxed);
+            while (start < cur && !span.start.compare_exchange_weak(cur, start, std::memory_order_relaxed)) {}
+            cur = span.end.load(std::memory_order_relaxed);
+            while (end > cur && !span.end.compare_exchange_weak(cur, end, std::memory_order_relaxed)) {}
+        }
+
+        // Per-system wall time in ns (0 for systems that did not run)
+        void collect(std::vector<double>& durations) const {
+            durations.resize(mSpans.size());
+            for (size_t i = 0; i < mSpans.size(); ++i) {
+                const int64_t start = mSpans[i].start.load(std::memory_order_relaxed);
+                const int64_t end = mSpans[i].end.load(std::memory_order_relaxed);
+                durations[i] = end > start ? static_cast<double>(end - start) : 0.0;
+            }
+        }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        struct Span {
+            std::atomic<int64_t> start{ 0 };
+            std::atomic<int64_t> end{ 0 };
+        };
+
+        std::vector<Span> mSpans;
+        Clock::time_point mOrigin = Clock::now();
+    };
+
+    // Every system once, in frame order, on the calling thread
+    inline void runSerial(const TaskGraph& graph, std::vector<double>& durations) {
+        SpanRecorder spans;
+        spans.reset(graph.size());
+        for (size_t i = 0; i < graph.size(); ++i) {
+            const int64_t start = spans.now();
+            graph[i].run(0, graph[i].items);
+            spans.record(i, start, spans.now());
+        }
+        spans.collect(durations);
+    }
+
+    // Runs a TaskGraph frame on N threads (the caller included). A system becomes ready once all of its
+    // predecessors are done; splittable systems are cut into chunks that go to the queue of the thread
+    // that released them, idle threads steal from the other end of their neighbours' queues.
+    class WorkStealingPool {
+    public:
+        explicit WorkStealingPool(size_t threads) : mQueues(std::max<size_t>(1, threads)) {
+            mWorkers.reserve(mQueues.size() - 1);
+            for (size_t i = 1; i < mQueues.size(); ++i) {
+                mWorkers.emplace_back([this, i] { workerLoop(i); });
+            }
+        }
+
+        ~WorkStealingPool() {
+            {
+                std::lock_guard lock(mMutex);
+                mStop.store(true, std::memory_order_relaxed);
+                mGeneration.fetch_add(1, std::memory_order_release);
+            }
+            mWake.notify_all();
+            for (auto& worker : mWorkers) {
+                worker.join();
+            }
+        }
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        size_t size() const { return mQueues.size(); }
+
+        // One frame; returns when every system is done. durations[i] = wall time of system i in ns.
+        void run(const TaskGraph& graph, std::vector<double>& durations) {
+            if (graph.size() == 0) {
+                durations.clear();
+                return;
+            }
+
+            mGraph = &graph;
+            if (mState.size() != graph.size()) {
+                mState = std::vector<SystemState>(graph.size());
+            }
+            mSpans.reset(graph.size());
+            for (size_t i = 0; i < graph.size(); ++i) {
+                auto& s = mState[i];
+                s.chunks = graph[i].splittable ? chunkCount(graph[i].items) : 1;
+                s.pendingChunks.store(s.chunks, std::memory_order_relaxed);
+                s.pendingPreds.store(graph.predecessors(i).size(), std::memory_order_relaxed);
+            }
+            mSystemsLeft.store(graph.size(), std::memory_order_relaxed);
+
+            // Roots are dealt round-robin so every thread starts with local work
+            size_t queue = 0;
+            for (size_t i = 0; i < graph.size(); ++i) {
+                if (graph.predecessors(i).empty()) {
+                    for (size_t c = 0; c < mState[i].chunks; ++c) {
+                        push(queue++ % size(), Task{ static_cast<uint32_t>(i), static_cast<uint32_t>(c) });
+                    }
+                }
+            }
+            {
+                std::lock_guard lock(mMutex);
+                mGeneration.fetch_add(1, std::memory_order_release);
+            }
+            mWake.notify_all();
+
+            workUntilDone(0);
+            mSpans.collect(durations);
+        }
+
+    private:
+        static constexpr int kSpinCount = 4096;
+        static constexpr size_t kChunksPerThread = 4;
+        static constexpr size_t kMinChunkItems = 2048;
+
+        struct Task {
+            uint32_t system;
+            uint32_t chunk;
+        };
+
+        struct alignas(64) Queue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        struct SystemState {
+            std::atomic<size_t> pendingPreds{ 0 };
+            std::atomic<size_t> pendingChunks{ 0 };
+            size_t chunks = 1;
+        };
+
+        size_t chunkCount(size_t items) const {
+            if (size() == 1) {
+                return 1;
+            }
+            return std::clamp<size_t>(items / kMinChunkItems, 1, size() * kChunksPerThread);
+        }
+
+        void push(size_t queue, Task task) {
+            std::lock_guard lock(mQueues[queue].mutex);
+            mQueues[queue].tasks.push_back(task);
+        }
+
+        bool pop(size_t self, Task& task) {
+            auto& q = mQueues[self];
+            std::lock_guard lock(q.mutex);
+            if (q.tasks.empty()) {
+                return false;
+            }
+            task = q.tasks.back();
+            q.tasks.pop_back();
+            return true;
+        }
+
+        bool steal(size_t self, Task& task) {
+            for (size_t k = 1; k < size(); ++k) {
+                auto& q = mQueues[(self + k) % size()];
+                std::lock_guard lock(q.mutex);
+                if (!q.tasks.empty()) {
+                    task = q.tasks.front();
+                    q.tasks.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void execute(size_t self, Task task) {
+            const System& system = (*mGraph)[task.system];
+            auto& s = mState[task.system];
+            const size_t begin = system.items * task.chunk / s.chunks;
+            const size_t end = system.items * (task.chunk + 1) / s.chunks;
+
+            const int64_t start = mSpans.now();
+            if (begin < end) {
+                system.run(begin, end);
+            }
+            mSpans.record(task.system, start, mSpans.now());
+
+            if (s.pendingChunks.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return;
+            }
+            for (auto succ : mGraph->successors(task.system)) {
+                if (mState[succ].pendingPreds.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    for (size_t c = 0; c < mState[succ].chunks; ++c) {
+                        push(self, Task{ static_cast<uint32_t>(succ), static_cast<uint32_t>(c) });
+                    }
+                }
+            }
+            mSystemsLeft.fetch_sub(1, std::memory_order_release);
+        }
+
+        void workUntilDone(size_t self) {
+            while (mSystemsLeft.load(std::memory_order_acquire) != 0) {
+                Task task;
+                if (pop(self, task) || steal(self, task)) {
+                    execute(self, task);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        void workerLoop(size_t self) {
+            uint64_t seen = 0;
+            for (;;) {
+                // Frames come back to back, so spin a little before going to sleep
+                uint64_t gen = mGeneration.load(std::memory_order_acquire);
+                for (int spin = 0; gen == seen && spin < kSpinCount; ++spin) {
+                    std::this_thread::yield();
+                    gen = mGeneration.load(std::memory_order_acquire);
+                }
+                if (gen == seen) {
+                    std::unique_lock lock(mMutex);
+                    mWake.wait(lock, [&] { return mGeneration.load(std::memory_order_acquire) != seen; });
+                    gen = mGeneration.load(std::memory_order_acquire);
+                }
+                seen = gen;
+                if (mStop.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                workUntilDone(self);
+            }
+        }
+
+        std::vector<Queue> mQueues;
+        std::vector<std::thread> mWorkers;
+        std::mutex mMutex;
+        std::condition_variable mWake;
+        std::atomic<uint64_t> mGeneration{ 0 };
+        std::atomic<size_t> mSystemsLeft{ 0 };
+        std::atomic<bool> mStop{ false };
+
+        const TaskGraph* mGraph = nullptr;
+        std::vector<SystemState> mState;
+        SpanRecorder mSpans;
+    };
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace mt {
+    // Fork-join pool for data-parallel system updates.
+    // The calling thread takes part in every parallelFor, so a pool of N threads spawns N - 1 workers.
+    class ThreadPool {
+    public:
+        explicit ThreadPool(size_t threads) {
+            const size_t workers = threads > 1 ? threads - 1 : 0;
+            mWorkers.reserve(workers);
+            for (size_t i = 0; i < workers; ++i) {
+                mWorkers.emplace_back([this, i] { workerLoop(i + 1); });
+            }
+        }
+
+        ~ThreadPool() {
+            {
+                std::lock_guard lock(mMutex);
+                mStop.store(true, std::memory_order_relaxed);
+                mGeneration.fetch_add(1, std::memory_order_release);
+            }
+            mWake.notify_all();
+            for (auto& worker : mWorkers) {
+                worker.join();
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        size_t size() const { return mWorkers.size() + 1; }
+
+        // Splits [0, count) into size() contiguous chunks and calls fn(begin, end) once per chunk.
+        // Returns when every chunk is done.
+        template <typename Fn>
+        void parallelFor(size_t count, Fn&& fn) {
+            if (mWorkers.empty()) {
+                fn(size_t(0), count);
+                return;
+            }
+
+            using FnT = std::remove_reference_t<Fn>;
+            mTask = [](void* ctx, size_t begin, size_t end) { (*static_cast<FnT*>(ctx))(begin, end); };
+            mCtx = const_cast<void*>(static_cast<const void*>(&fn));
+            mCount = count;
+            mPending.store(mWorkers.size(), std::memory_order_relaxed);
+            {
+                std::lock_guard lock(mMutex);
+                mGeneration.fetch_add(1, std::memory_order_release);
+            }
+            mWake.notify_all();
+
+            runChunk(0);
+            while (mPending.load(std::memory_order_acquire) != 0) {
+                std::this_thread::yield();
+            }
+        }
+
+    private:
+        static constexpr int kSpinCount = 4096;
+
+        void runChunk(size_t idx) {
+            const size_t begin = mCount * idx / size();
+            const size_t end = mCount * (idx + 1) / size();
+            if (begin < end) {
+                mTask(mCtx, begin, end);
+            }
+        }
+
+        void workerLoop(size_t idx) {
+            uint64_t seen = 0;
+            for (;;) {
+                // Frames come back to back, so spin a little before going to sleep
+                uint64_t gen = mGeneration.load(std::memory_order_acquire);
+                for (int spin = 0; gen == seen && spin < kSpinCount; ++spin) {
+                    std::this_thread::yield();
+                    gen = mGeneration.load(std::memory_order_acquire);
+                }
+                if (gen == seen) {
+                    std::unique_lock lock(mMutex);
+                    mWake.wait(lock, [&] { return mGeneration.load(std::memory_order_acquire) != seen; });
+                    gen = mGeneration.load(std::memory_order_acquire);
+                }
+                seen = gen;
+                if (mStop.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                runChunk(idx);
+                mPending.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        std::vector<std::thread> mWorkers;
+        std::mutex mMutex;
+        std::condition_variable mWake;
+        std::atomic<uint64_t> mGeneration{ 0 };
+        std::atomic<size_t> mPending{ 0 };
+        std::atomic<bool> mStop{ false };
+
+        void (*mTask)(void*, size_t, size_t) = nullptr;
+        void* mCtx = nullptr;
+        size_t mCount = 0;
+    };
+
+    // 1, 2, 4, ... up to the machine's core count (always included)
+    inline std::vector<int64_t> threadCounts() {
+        const int64_t hw = std::max<int64_t>(1, std::thread::hardware_concurrency());
+        std::vector<int64_t> counts;
+        for (int64_t t = 1; t < hw; t *= 2) {
+            counts.push_back(t);
+        }
+        counts.push_back(hw);
+        return counts;
+    }
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#ifndef ECSS_BENCH_PERF_COUNTERS
+#define ECSS_BENCH_PERF_COUNTERS 0
+#endif
+
+// Hardware counters around a timing loop, reported per processed entity.
+// Linux only (perf_event_open); with ECSS_BENCH_PERF_COUNTERS off PERF_ENTITY_COUNTERS is a no-op.
+// Counters the PMU/kernel refuses (VMs, perf_event_paranoid) are silently left out of the output.
+// Usage: place right before `for (auto _ : state)` so setup is not counted.
+#if ECSS_BENCH_PERF_COUNTERS && defined(__linux__)
+
+#include <array>
+#include <cstring>
+#include <string>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace perf {
+    struct EventDesc {
+        const char* name;
+        uint32_t type;
+        uint64_t config;
+    };
+
+    constexpr uint64_t cacheMiss(uint64_t cache) {
+        return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    }
+
+    inline constexpr std::array<EventDesc, 6> kEvents{{
+        { "cycles",        PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+        { "instructions",  PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+        { "branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+        { "l1d_misses",    PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_L1D) },
+        { "llc_misses",    PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_LL) },
+        { "dtlb_misses",   PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_DTLB) },
+    }};
+
+    class EntityCounters {
+    public:
+        EntityCounters(benchmark::State& state, int64_t entitiesPerIteration)
+            : mState(state), mEntities(entitiesPerIteration) {
+            for (size_t i = 0; i < kEvents.size(); ++i) {
+                perf_event_attr attr;
+                std::memset(&attr, 0, sizeof(attr));
+                attr.size = sizeof(attr);
+                attr.type = kEvents[i].type;
+                attr.config = kEvents[i].config;
+                attr.disabled = 1;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+                mFds[i] = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+            }
+            for (int fd : mFds) {
+                if (fd >= 0) {
+                    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+            }
+        }
+
+        ~EntityCounters() {
+            for (int fd : mFds) {
+                if (fd >= 0) {
+                    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+                }
+            }
+
+            std::array<double, kEvents.size()> values{};
+            std::array<bool, kEvents.size()> valid{};
+            for (size_t i = 0; i < kEvents.size(); ++i) {
+                uint64_t data[3] = {}; // value, time enabled, time running
+                if (mFds[i] >= 0 && read(mFds[i], data, sizeof(data)) == sizeof(data) && data[2] > 0) {
+                    // Scale up if the kernel had to multiplex the counter
+                    values[i] = static_cast<double>(data[0]) * static_cast<double>(data[1]) / static_cast<double>(data[2]);
+                    valid[i] = true;
+                }
+                if (mFds[i] >= 0) {
+                    close(mFds[i]);
+                }
+            }
+
+            const double entities = static_cast<double>(mState.iterations()) * static_cast<double>(mEntities);
+            if (entities <= 0.0) {
+                return;
+            }
+            for (size_t i = 1; i < kEvents.size(); ++i) {
+                if (valid[i]) {
+                    mState.counters[std::string(kEvents[i].name) + "_per_entity"] = values[i] / entities;
+                }
+            }
+            if (valid[0] && valid[1] && values[0] > 0.0) {
+                mState.counters["ipc"] = values[1] / values[0];
+            }
+        }
+
+        EntityCounters(const EntityCounters&) = delete;
+        EntityCounters& operator=(const EntityCounters&) = delete;
+
+    private:
+        benchmark::State& mState;
+        int64_t mEntities;
+        std::array<int, kEvents.size()> mFds{};
+    };
+}
+
+#define PERF_ENTITY_COUNTERS(state, entities) ::perf::EntityCounters perfEntityCounters_((state), (entities))
+
+#else
+
+#define PERF_ENTITY_COUNTERS(state, entities) ((void)0)
+
+#endif
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include "latency_histogram.h"
+#include "memory_tracking.h"
+#include "trace_zones.h"
+
+// Registration macros shared by the ecss_benchmarks translation units.
+// Names follow <ecs>.....................<func> and realistic/<ecs>/<func>; CI baselines key on them.
+
+#define TO_FUNC_NAME(funcName, ecs) #ecs "....................." #funcName
+
+#define BENCH_ARGS(F, ECS, FUNC) \
+    F(ECS, FUNC, 1000) \
+    F(ECS, FUNC, 5000) \
+    F(ECS, FUNC, 50000) \
+    F(ECS, FUNC, 250000) \
+    F(ECS, FUNC, 500000) \
+    F(ECS, FUNC, 1000000)
+
+// Every registered benchmark also reports peak_bytes / bytes_per_entity / allocs (see memory_tracking.h)
+#define BENCH_ONE(ECS, FUNC, ARG) \
+    BENCHMARK(memtrack::tracked<ECS::FUNC>)->Name(TO_FUNC_NAME(FUNC, ECS))->Unit(benchmark::TimeUnit::kMicrosecond)->Arg(ARG)->MinTime(0.3);
+
+// MSVC has issues with std::atomic::wait()/notify_all() used in ecss_ts (thread-safe version)
+// Skip ecss_ts benchmarks on Windows to avoid hangs/crashes
+#ifdef _MSC_VER
+#define REGISTER_BENCHMARK_WITH(ONE, ecs0, ecs1, ecs2, ecs3, ecs4, FUNC) \
+    BENCH_ARGS(ONE, ecs0, FUNC) \
+    BENCH_ARGS(ONE, ecs1, FUNC) \
+    BENCH_ARGS(ONE, ecs3, FUNC) \
+    BENCH_ARGS(ONE, ecs4, FUNC)
+#else
+#define REGISTER_BENCHMARK_WITH(ONE, ecs0, ecs1, ecs2, ecs3, ecs4, FUNC) \
+    BENCH_ARGS(ONE, ecs0, FUNC) \
+    BENCH_ARGS(ONE, ecs1, FUNC) \
+    BENCH_ARGS(ONE, ecs2, FUNC) \
+    BENCH_ARGS(ONE, ecs3, FUNC) \
+    BENCH_ARGS(ONE, ecs4, FUNC)
+#endif
+
+#define REGISTER_BENCHMARK(ecs0, ecs1, ecs2, ecs3, ecs4, FUNC) \
+    REGISTER_BENCHMARK_WITH(BENCH_ONE, ecs0, ecs1, ecs2, ecs3, ecs4, FUNC)
+
+// Same rows with every allocation served from the pre-faulted arena: <ecs>.....................<func>_arena
+#define BENCH_ARENA_ONE(ECS, FUNC, ARG) \
+    BENCHMARK(memtrack::tracked<memtrack::withArena<ECS::FUNC>>)->Name(TO_FUNC_NAME(FUNC##_arena, ECS))->Unit(benchmark::TimeUnit::kMicrosecond)->Arg(ARG)->MinTime(0.3);
+
+#define REGISTER_ARENA_BENCHMARK(ecs0, ecs1, ecs2, ecs3, ecs4, FUNC) \
+    REGISTER_BENCHMARK_WITH(BENCH_ARENA_ONE, ecs0, ecs1, ecs2, ecs3, ecs4, FUNC)
+
+// Same rows on the huge-page, NUMA-local arena: <ecs>.....................<func>_hugepages
+#define BENCH_HUGEPAGES_ONE(ECS, FUNC, ARG) \
+    BENCHMARK(memtrack::tracked<memtrack::withHugePages<ECS::FUNC>>)->Name(TO_FUNC_NAME(FUNC##_hugepages, ECS))->Unit(benchmark::TimeUnit::kMicrosecond)->Arg(ARG)->MinTime(0.3);
+
+#define REGISTER_HUGEPAGES_BENCHMARK(ecs0, ecs1, ecs2, ecs3, ecs4, FUNC) \
+    REGISTER_BENCHMARK_WITH(BENCH_HUGEPAGES_ONE, ecs0, ecs1, ecs2, ecs3, ecs4, FUNC)
+
+// Realistic scenarios: realistic/<ecs>/<func>/<entities>
+#define BENCH_REALISTIC_ARGS(F, ECS, FUNC) \
+    F(ECS, FUNC, 1000) \
+    F(ECS, FUNC, 100000) \
+    F(ECS, FUNC, 1000000)
+
+// Zones inside the scenario (TRACE_ZONE) end up as zone_<name>_us counters, see trace_zones.h
+#define BENCH_REALISTIC_ONE(ECS, FUNC, ARG) \
+    BENCHMARK(trace::zoned<memtrack::tracked<realistic::ECS::FUNC>>)->Name("realistic/" #ECS "/" #FUNC)->Unit(benchmark::TimeUnit::kMicrosecond)->Arg(ARG)->MinTime(0.3);
+
+#define REGISTER_REALISTIC(ecs1, ecs2, ecs3, FUNC) \
+    BENCH_REALISTIC_ARGS(BENCH_REALISTIC_ONE, ecs1, FUNC) \
+    BENCH_REALISTIC_ARGS(BENCH_REALISTIC_ONE, ecs2, FUNC) \
+    BENCH_REALISTIC_ARGS(BENCH_REALISTIC_ONE, ecs3, FUNC)
+
+// realistic/<ecs>/<func>_hugepages/<entities> on the huge-page arena (memtrack::withHugePages)
+#define BENCH_REALISTIC_HUGEPAGES_ONE(ECS, FUNC, ARG) \
+    BENCHMARK(memtrack::tracked<memtrack::withHugePages<realistic::ECS::FUNC>>)->Name("realistic/" #ECS "/" #FUNC "_hugepages")->Unit(benchmark::TimeUnit::kMicrosecond)->Arg(ARG)->MinTime(0.3);
+
+#define REGISTER_REALISTIC_HUGEPAGES(ecs1, ecs2, ecs3, FUNC) \
+    BENCH_REALISTIC_ARGS(BENCH_REALISTIC_HUGEPAGES_ONE, ecs1, FUNC) \
+    BENCH_REALISTIC_ARGS(BENCH_REALISTIC_HUGEPAGES_ONE, ecs2, FUNC) \
+    BENCH_REALISTIC_ARGS(BENCH_REALISTIC_HUGEPAGES_ONE, ecs3, FUNC)
+
+// Latency mode: realistic/<ecs>/<func>/latency/<entities>/manual_time, every frame timed on its own with
+// p50_us / p99_us / p999_us / max_us counters (see latency_histogram.h). Only for scenarios whose timing loop
+// iterates latency::Frames - with a plain State loop nothing sets the manual time.
+#define BENCH_REALISTIC_LATENCY_ONE(ECS, FUNC, ARG) \
+    BENCHMARK(latency::perFrame<trace::zoned<memtrack::tracked<realistic::ECS::FUNC>>>)->Name("realistic/" #ECS "/" #FUNC "/latency")->Unit(benchmark::TimeUnit::kMicrosecond)->Arg(ARG)->UseManualTime()->MinTime(0.3);
+
+#define REGISTER_REALISTIC_LATENCY(ecs1, ecs2, ecs3, FUNC) \
+    BENCH_REALISTIC_ARGS(BENCH_REALISTIC_LATENCY_ONE, ecs1, FUNC) \
+    BENCH_REALISTIC_ARGS(BENCH_REALISTIC_LATENCY_ONE, ecs2, FUNC) \
+    BENCH_REALISTIC_ARGS(BENCH_REALISTIC_LATENCY_ONE, ecs3, FUNC)
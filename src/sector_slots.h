@@ -0,0 +1,55 @@
+#pragma once
+
+#include <ecss/Registry.h>
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Linear slot walk over the sector container that holds Lead (and, if grouped with registerArray, Rest...),
+// the same access has_component uses: slot index -> alive bits -> member at its layout offset.
+// A dense slot range needs no per-entity lookup, so ranges can be handed to different workers:
+//     sectors::Slots<Transform, RigidBody> slots(reg);
+//     pool.parallelFor(slots.size(), [&](size_t begin, size_t end) {
+//         slots.each(begin, end, [](size_t slot, Transform& t, RigidBody& rb) { ... });
+//     });
+// Slots where one of the components is not alive (never added, destroyed) are skipped. Rest... must live in
+// Lead's container. Only container metadata is read, so the registry must not change structurally meanwhile.
+namespace sectors {
+    template <typename Lead, typename... Rest>
+    class Slots {
+    public:
+        explicit Slots(ecss::Registry<false>& reg)
+            : mContainer(reg.template getComponentContainer<Lead>())
+            , mLayouts{ &mContainer->template getLayoutData<Lead>(), &mContainer->template getLayoutData<Rest>()... } {}
+
+        size_t size() const { return mContainer->template size<false>(); }
+
+        template <typename Fn>
+        void each(size_t begin, size_t end, Fn&& fn) const {
+            eachImpl(begin, end, fn, std::index_sequence_for<Lead, Rest...>{});
+        }
+
+    private:
+        using Container = std::remove_pointer_t<decltype(std::declval<ecss::Registry<false>&>().template getComponentContainer<Lead>())>;
+        using Layout = std::remove_cvref_t<decltype(std::declval<Container&>().template getLayoutData<Lead>())>;
+        using Types = std::tuple<Lead, Rest...>;
+
+        template <typename Fn, size_t... I>
+        void eachImpl(size_t begin, size_t end, Fn& fn, std::index_sequence<I...>) const {
+            for (size_t slot = begin; slot < end; ++slot) {
+                const auto& alive = mContainer->template getIsAliveRef<false>(slot);
+                if (!(ecss::Memory::Sector::isAlive(alive, mLayouts[I]->isAliveMask) && ...)) {
+                    continue;
+                }
+                std::byte* sector = mContainer->template at<false>(slot);
+                fn(slot, *reinterpret_cast<std::tuple_element_t<I, Types>*>(sector + mLayouts[I]->offset)...);
+            }
+        }
+
+        Container* mContainer;
+        std::array<const Layout*, 1 + sizeof...(Rest)> mLayouts;
+    };
+}
@@ -0,0 +1,297 @@
+#include "simd_kernels.h"
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define ECSS_SIMD_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define ECSS_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if defined(ECSS_SIMD_X86) && !defined(_MSC_VER)
+#define ECSS_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define ECSS_TARGET_AVX2
+#endif
+
+namespace {
+    constexpr float kGravity = 98.f;
+    constexpr float kDamping = 0.99f;
+
+    // Reference implementations, also used for run tails
+    void rigidBodiesScalar(simd::Span<Transform> t, simd::Span<RigidBody> rb, size_t begin, size_t end, float dt) {
+        for (size_t i = begin; i < end; ++i) {
+            RigidBody& b = rb[i];
+            Transform& x = t[i];
+            const float keep = 1.f - b.drag * dt;
+            b.vx = (b.vx + b.ax * dt) * keep;
+            b.vy = (b.vy + b.ay * dt) * keep;
+            b.vz = (b.vz + b.az * dt) * keep;
+            x.x += b.vx * dt;
+            x.y += b.vy * dt;
+            x.z += b.vz * dt;
+        }
+    }
+
+    void particlesScalar(simd::Span<Position> p, simd::Span<Velocity> v, size_t begin, size_t end, float dt) {
+        for (size_t i = begin; i < end; ++i) {
+            Velocity& vel = v[i];
+            Position& pos = p[i];
+            vel.vy -= kGravity * dt;
+            pos.x += vel.vx * dt;
+            pos.y += vel.vy * dt;
+            pos.z += vel.vz * dt;
+            vel.vx *= kDamping;
+            vel.vy *= kDamping;
+            vel.vz *= kDamping;
+        }
+    }
+
+#if ECSS_SIMD_X86
+    bool detectAvx2() {
+#ifdef _MSC_VER
+        int regs[4];
+        __cpuid(regs, 0);
+        if (regs[0] < 7) return false;
+        __cpuid(regs, 1);
+        const bool osxsave = (regs[2] & (1 << 27)) != 0;
+        const bool fma = (regs[2] & (1 << 12)) != 0;
+        if (!osxsave || !fma || (_xgetbv(0) & 0x6) != 0x6) return false;
+        __cpuidex(regs, 7, 0);
+        return (regs[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+    }
+
+    const bool gHasAvx2 = detectAvx2();
+
+    // In-place 8x8 transpose: rows of 8 RigidBody floats <-> 8 field vectors (its own inverse)
+    ECSS_TARGET_AVX2 inline void transpose8(__m256 r[8]) {
+        const __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]), t1 = _mm256_unpackhi_ps(r[0], r[1]);
+        const __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]), t3 = _mm256_unpackhi_ps(r[2], r[3]);
+        const __m256 t4 = _mm256_unpacklo_ps(r[4], r[5]), t5 = _mm256_unpackhi_ps(r[4], r[5]);
+        const __m256 t6 = _mm256_unpacklo_ps(r[6], r[7]), t7 = _mm256_unpackhi_ps(r[6], r[7]);
+        const __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)), s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)), s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0)), s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0)), s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+        r[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+        r[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+        r[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+        r[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+        r[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+        r[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+        r[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+        r[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+    }
+
+    // 8 bodies per step: RigidBody is exactly one __m256, transposed to SoA and back.
+    // Transform (40 bytes) is read with gathers and written back per lane.
+    ECSS_TARGET_AVX2 void rigidBodiesAvx2(simd::Span<Transform> t, simd::Span<RigidBody> rb, size_t count, float dt) {
+        const __m256 vdt = _mm256_set1_ps(dt);
+        const __m256 one = _mm256_set1_ps(1.f);
+        const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256i tOffsets = _mm256_mullo_epi32(lanes, _mm256_set1_epi32(static_cast<int>(t.stride)));
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256 r[8];
+            for (int k = 0; k < 8; ++k) {
+                r[k] = _mm256_loadu_ps(&rb[i + k].vx);
+            }
+            transpose8(r); // r[0..7] = vx vy vz ax ay az mass drag
+            const __m256 keep = _mm256_fnmadd_ps(r[7], vdt, one);
+            r[0] = _mm256_mul_ps(_mm256_fmadd_ps(r[3], vdt, r[0]), keep);
+            r[1] = _mm256_mul_ps(_mm256_fmadd_ps(r[4], vdt, r[1]), keep);
+            r[2] = _mm256_mul_ps(_mm256_fmadd_ps(r[5], vdt, r[2]), keep);
+
+            const float* tBase = &t[i].x;
+            alignas(32) float pos[3][8];
+            _mm256_store_ps(pos[0], _mm256_fmadd_ps(r[0], vdt, _mm256_i32gather_ps(tBase + 0, tOffsets, 1)));
+            _mm256_store_ps(pos[1], _mm256_fmadd_ps(r[1], vdt, _mm256_i32gather_ps(tBase + 1, tOffsets, 1)));
+            _mm256_store_ps(pos[2], _mm256_fmadd_ps(r[2], vdt, _mm256_i32gather_ps(tBase + 2, tOffsets, 1)));
+
+            transpose8(r);
+            for (int k = 0; k < 8; ++k) {
+                _mm256_storeu_ps(&rb[i + k].vx, r[k]);
+                Transform& x = t[i + k];
+                x.x = pos[0][k];
+                x.y = pos[1][k];
+                x.z = pos[2][k];
+            }
+        }
+        rigidBodiesScalar(t, rb, i, count, dt);
+    }
+
+    // Packed Position/Velocity arrays are flat float streams with a period of 3 (x y z x y z ...):
+    // 8 particles = 3 vectors each, gravity applied through a matching y-lane pattern.
+    ECSS_TARGET_AVX2 void particlesPackedAvx2(Position* p, Velocity* v, size_t count, float dt) {
+        const __m256 vdt = _mm256_set1_ps(dt);
+        const __m256 damping = _mm256_set1_ps(kDamping);
+        const float g = kGravity * dt;
+        const __m256 gravity[3] = {
+            _mm256_setr_ps(0.f, g, 0.f, 0.f, g, 0.f, 0.f, g),
+            _mm256_setr_ps(0.f, 0.f, g, 0.f, 0.f, g, 0.f, 0.f),
+            _mm256_setr_ps(g, 0.f, 0.f, g, 0.f, 0.f, g, 0.f),
+        };
+        auto* pf = reinterpret_cast<float*>(p);
+        auto* vf = reinterpret_cast<float*>(v);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            for (int k = 0; k < 3; ++k) {
+                float* pk = pf + i * 3 + k * 8;
+                float* vk = vf + i * 3 + k * 8;
+                const __m256 vel = _mm256_sub_ps(_mm256_loadu_ps(vk), gravity[k]);
+                _mm256_storeu_ps(pk, _mm256_fmadd_ps(vel, vdt, _mm256_loadu_ps(pk)));
+                _mm256_storeu_ps(vk, _mm256_mul_ps(vel, damping));
+            }
+        }
+        particlesScalar(simd::Span<Position>{ p }, simd::Span<Velocity>{ v }, i, count, dt);
+    }
+
+    // Interleaved spans: fields gathered into lanes, results written back per lane
+    ECSS_TARGET_AVX2 void particlesStridedAvx2(simd::Span<Position> p, simd::Span<Velocity> v, size_t count, float dt) {
+        const __m256 vdt = _mm256_set1_ps(dt);
+        const __m256 damping = _mm256_set1_ps(kDamping);
+        const __m256 gravity = _mm256_set1_ps(kGravity * dt);
+        const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256i pOffsets = _mm256_mullo_epi32(lanes, _mm256_set1_epi32(static_cast<int>(p.stride)));
+        const __m256i vOffsets = _mm256_mullo_epi32(lanes, _mm256_set1_epi32(static_cast<int>(v.stride)));
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            const float* pBase = &p[i].x;
+            const float* vBase = &v[i].vx;
+            alignas(32) float out[6][8];
+            for (int c = 0; c < 3; ++c) {
+                __m256 vel = _mm256_i32gather_ps(vBase + c, vOffsets, 1);
+                if (c == 1) {
+                    vel = _mm256_sub_ps(vel, gravity);
+                }
+                _mm256_store_ps(out[c], _mm256_fmadd_ps(vel, vdt, _mm256_i32gather_ps(pBase + c, pOffsets, 1)));
+                _mm256_store_ps(out[3 + c], _mm256_mul_ps(vel, damping));
+            }
+            for (int k = 0; k < 8; ++k) {
+                Position& pos = p[i + k];
+                Velocity& vel = v[i + k];
+                pos.x = out[0][k]; pos.y = out[1][k]; pos.z = out[2][k];
+                vel.vx = out[3][k]; vel.vy = out[4][k]; vel.vz = out[5][k];
+            }
+        }
+        particlesScalar(p, v, i, count, dt);
+    }
+#endif
+
+#if ECSS_SIMD_NEON
+    inline void transpose4(float32x4_t& a, float32x4_t& b, float32x4_t& c, float32x4_t& d) {
+        const float32x4x2_t ab = vtrnq_f32(a, b);
+        const float32x4x2_t cd = vtrnq_f32(c, d);
+        a = vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0]));
+        b = vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1]));
+        c = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0]));
+        d = vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]));
+    }
+
+    // 4 bodies per step: each RigidBody is two q-registers, transposed to SoA and back
+    void rigidBodiesNeon(simd::Span<Transform> t, simd::Span<RigidBody> rb, size_t count, float dt) {
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            float32x4_t lo[4], hi[4];
+            for (int k = 0; k < 4; ++k) {
+                lo[k] = vld1q_f32(&rb[i + k].vx);
+                hi[k] = vld1q_f32(&rb[i + k].ay);
+            }
+            transpose4(lo[0], lo[1], lo[2], lo[3]); // vx vy vz ax
+            transpose4(hi[0], hi[1], hi[2], hi[3]); // ay az mass drag
+            const float32x4_t keep = vmlsq_n_f32(vdupq_n_f32(1.f), hi[3], dt);
+            lo[0] = vmulq_f32(vmlaq_n_f32(lo[0], lo[3], dt), keep);
+            lo[1] = vmulq_f32(vmlaq_n_f32(lo[1], hi[0], dt), keep);
+            lo[2] = vmulq_f32(vmlaq_n_f32(lo[2], hi[1], dt), keep);
+
+            float vel[3][4];
+            vst1q_f32(vel[0], lo[0]);
+            vst1q_f32(vel[1], lo[1]);
+            vst1q_f32(vel[2], lo[2]);
+
+            transpose4(lo[0], lo[1], lo[2], lo[3]);
+            for (int k = 0; k < 4; ++k) {
+                vst1q_f32(&rb[i + k].vx, lo[k]);
+                Transform& x = t[i + k];
+                x.x += vel[0][k] * dt;
+                x.y += vel[1][k] * dt;
+                x.z += vel[2][k] * dt;
+            }
+        }
+        rigidBodiesScalar(t, rb, i, count, dt);
+    }
+
+    // Same period-3 flat stream trick as AVX2: 4 particles = 3 q-registers each
+    void particlesPackedNeon(Position* p, Velocity* v, size_t count, float dt) {
+        const float g = kGravity * dt;
+        const float gravityLanes[3][4] = { { 0.f, g, 0.f, 0.f }, { g, 0.f, 0.f, g }, { 0.f, 0.f, g, 0.f } };
+        const float32x4_t gravity[3] = { vld1q_f32(gravityLanes[0]), vld1q_f32(gravityLanes[1]), vld1q_f32(gravityLanes[2]) };
+        auto* pf = reinterpret_cast<float*>(p);
+        auto* vf = reinterpret_cast<float*>(v);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            for (int k = 0; k < 3; ++k) {
+                float* pk = pf + i * 3 + k * 4;
+                float* vk = vf + i * 3 + k * 4;
+                const float32x4_t vel = vsubq_f32(vld1q_f32(vk), gravity[k]);
+                vst1q_f32(pk, vmlaq_n_f32(vld1q_f32(pk), vel, dt));
+                vst1q_f32(vk, vmulq_n_f32(vel, kDamping));
+            }
+        }
+        particlesScalar(simd::Span<Position>{ p }, simd::Span<Velocity>{ v }, i, count, dt);
+    }
+#endif
+}
+
+namespace simd {
+    const char* isa() {
+#if ECSS_SIMD_X86
+        return gHasAvx2 ? "avx2" : "scalar";
+#elif ECSS_SIMD_NEON
+        return "neon";
+#else
+        return "scalar";
+#endif
+    }
+
+    void integrateRigidBodies(Span<Transform> t, Span<RigidBody> rb, size_t count, float dt) {
+#if ECSS_SIMD_X86
+        if (gHasAvx2) {
+            rigidBodiesAvx2(t, rb, count, dt);
+            return;
+        }
+#elif ECSS_SIMD_NEON
+        rigidBodiesNeon(t, rb, count, dt);
+        return;
+#endif
+        rigidBodiesScalar(t, rb, 0, count, dt);
+    }
+
+    void integrateParticles(Span<Position> p, Span<Velocity> v, size_t count, float dt) {
+        const bool packed = p.packed() && v.packed();
+#if ECSS_SIMD_X86
+        if (gHasAvx2) {
+            if (packed) {
+                particlesPackedAvx2(&p[0], &v[0], count, dt);
+            } else {
+                particlesStridedAvx2(p, v, count, dt);
+            }
+            return;
+        }
+#elif ECSS_SIMD_NEON
+        if (packed) {
+            particlesPackedNeon(&p[0], &v[0], count, dt);
+            return;
+        }
+#endif
+        particlesScalar(p, v, 0, count, dt);
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+
+#include "components.h"
+
+// Hand-vectorized versions of the physics_integration and particle_system lambdas, run over spans
+// of components instead of one entity per callback.
+// A span is a base pointer plus a byte stride, so both packed arrays (EnTT pages, flecs columns) and
+// interleaved ECSS sectors (Transform and RigidBody side by side) can be passed in.
+// x86-64: AVX2 (+FMA) picked at runtime, no -mavx2 needed. AArch64: NEON. Otherwise scalar.
+namespace simd {
+    template <typename T>
+    struct Span {
+        void* base = nullptr;
+        size_t stride = sizeof(T);
+
+        T& operator[](size_t i) const {
+            return *reinterpret_cast<T*>(static_cast<char*>(base) + i * stride);
+        }
+        bool packed() const { return stride == sizeof(T); }
+    };
+
+    // "avx2", "neon" or "scalar" - the kernels below use this path
+    const char* isa();
+
+    // rb.v += rb.a * dt; rb.v *= 1 - rb.drag * dt; t.xyz += rb.v * dt
+    void integrateRigidBodies(Span<Transform> t, Span<RigidBody> rb, size_t count, float dt);
+
+    // v.vy -= 98 * dt; p += v * dt; v *= 0.99
+    void integrateParticles(Span<Position> p, Span<Velocity> v, size_t count, float dt);
+
+    // Recovers spans from the entity-at-a-time callbacks of a view: consecutive calls whose pointers
+    // keep the same stride are merged and handed to Kernel in one go.
+    template <typename A, typename B, void (*Kernel)(Span<A>, Span<B>, size_t, float)>
+    class SpanCollector {
+    public:
+        explicit SpanCollector(float dt) : mDt(dt) {}
+        ~SpanCollector() { flush(); }
+
+        SpanCollector(const SpanCollector&) = delete;
+        SpanCollector& operator=(const SpanCollector&) = delete;
+
+        void push(A& a, B& b) {
+            auto* pa = reinterpret_cast<char*>(&a);
+            auto* pb = reinterpret_cast<char*>(&b);
+            auto* baseA = static_cast<char*>(mA.base);
+            auto* baseB = static_cast<char*>(mB.base);
+            if (mCount == 1) {
+                // the second element fixes the stride of the run
+                if (pa >= baseA + sizeof(A) && pb >= baseB + sizeof(B)) {
+                    mA.stride = static_cast<size_t>(pa - baseA);
+                    mB.stride = static_cast<size_t>(pb - baseB);
+                    ++mCount;
+                    return;
+                }
+                flush();
+            } else if (mCount > 1) {
+                if (mCount < kMaxRun && pa == baseA + mCount * mA.stride && pb == baseB + mCount * mB.stride) {
+                    ++mCount;
+                    return;
+                }
+                flush();
+            }
+            mA.base = pa;
+            mB.base = pb;
+            mCount = 1;
+        }
+
+        void flush() {
+            if (mCount > 0) {
+                Kernel(mA, mB, mCount, mDt);
+                mCount = 0;
+            }
+        }
+
+    private:
+        static constexpr size_t kMaxRun = 1024;
+
+        Span<A> mA;
+        Span<B> mB;
+        size_t mCount = 0;
+        float mDt;
+    };
+}
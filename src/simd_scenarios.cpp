@@ -0,0 +1,185 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "components.h"
+#include "registration.h"
+#include "simd_kernels.h"
+
+// physics_integration / particle_system with the per-entity lambda replaced by simd:: kernels over spans.
+// Same worlds and math as the scalar rows in benchmark.cpp; the row label names the instruction set used.
+//  ECSS  - no span API: runs are recovered from the addresses view.each() hands out (SpanCollector)
+//  EnTT  - owning group, then one kernel call per storage page
+//  flecs - one kernel call per table, straight from it.field<T>()
+namespace {
+    constexpr float kDt = 1.f / 60.f;
+
+    Transform bodyTransform(int i) {
+        return Transform{ (float)i, (float)(i * 2), 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f };
+    }
+
+    RigidBody fallingBody() {
+        return RigidBody{ 1.f, 0.5f, 0.f, 0.f, -9.8f, 0.f, 1.f, 0.1f };
+    }
+
+    Position particlePosition(int i) {
+        return Position{ (float)(i % 100), (float)((i / 100) % 100), 0.f };
+    }
+
+    Velocity particleVelocity(int i) {
+        const float angle = (float)(i % 360) * 3.14159f / 180.f;
+        const float speed = 50.f + (float)(i % 100);
+        return Velocity{ std::cos(angle) * speed, std::sin(angle) * speed, 0.f };
+    }
+
+    // Kernel calls over the first `count` elements of two pools aligned by an owning group
+    template <typename A, typename B, void (*Kernel)(simd::Span<A>, simd::Span<B>, size_t, float)>
+    void forEachPage(entt::registry& reg, size_t count, float dt) {
+        constexpr size_t pageA = entt::component_traits<A>::page_size;
+        constexpr size_t pageB = entt::component_traits<B>::page_size;
+        constexpr size_t page = std::min(pageA, pageB);
+        A* const* pagesA = reg.storage<A>().raw();
+        B* const* pagesB = reg.storage<B>().raw();
+        for (size_t first = 0; first < count; first += page) {
+            const size_t run = std::min(page, count - first);
+            Kernel(simd::Span<A>{ pagesA[first / pageA] + first % pageA }, simd::Span<B>{ pagesB[first / pageB] + first % pageB }, run, dt);
+        }
+    }
+}
+
+namespace realistic {
+namespace ecss_r {
+    using Reg = ecss::Registry<false>;
+
+    static void physics_integration_simd(benchmark::State& state) {
+        Reg reg;
+        reg.registerArray<Transform, RigidBody>();
+        const int n = state.range(0);
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            reg.addComponent<Transform>(e, bodyTransform(i));
+            reg.addComponent<RigidBody>(e, fallingBody());
+        }
+
+        auto view = reg.view<Transform, RigidBody>();
+        for (auto _ : state) {
+            simd::SpanCollector<Transform, RigidBody, &simd::integrateRigidBodies> spans(kDt);
+            view.each([&](Transform& t, RigidBody& rb) { spans.push(t, rb); });
+            spans.flush();
+            benchmark::ClobberMemory();
+        }
+        state.SetLabel(simd::isa());
+    }
+
+    static void particle_system_simd(benchmark::State& state) {
+        Reg reg;
+        reg.registerArray<Position, Velocity>();
+        const int n = state.range(0);
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            reg.addComponent<Position>(e, particlePosition(i));
+            reg.addComponent<Velocity>(e, particleVelocity(i));
+        }
+
+        auto view = reg.view<Position, Velocity>();
+        for (auto _ : state) {
+            simd::SpanCollector<Position, Velocity, &simd::integrateParticles> spans(kDt);
+            view.each([&](Position& p, Velocity& v) { spans.push(p, v); });
+            spans.flush();
+            benchmark::ClobberMemory();
+        }
+        state.SetLabel(simd::isa());
+    }
+} // namespace ecss_r
+
+namespace entt_r {
+    static void physics_integration_simd(benchmark::State& state) {
+        entt::registry reg;
+        auto group = reg.group<Transform, RigidBody>();
+        const int n = state.range(0);
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.create();
+            reg.emplace<Transform>(e, bodyTransform(i));
+            reg.emplace<RigidBody>(e, fallingBody());
+        }
+
+        for (auto _ : state) {
+            forEachPage<Transform, RigidBody, &simd::integrateRigidBodies>(reg, group.size(), kDt);
+            benchmark::ClobberMemory();
+        }
+        state.SetLabel(simd::isa());
+    }
+
+    static void particle_system_simd(benchmark::State& state) {
+        entt::registry reg;
+        auto group = reg.group<Position, Velocity>();
+        const int n = state.range(0);
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.create();
+            reg.emplace<Position>(e, particlePosition(i));
+            reg.emplace<Velocity>(e, particleVelocity(i));
+        }
+
+        for (auto _ : state) {
+            forEachPage<Position, Velocity, &simd::integrateParticles>(reg, group.size(), kDt);
+            benchmark::ClobberMemory();
+        }
+        state.SetLabel(simd::isa());
+    }
+} // namespace entt_r
+
+namespace flecs_r {
+    static void physics_integration_simd(benchmark::State& state) {
+        flecs::world world;
+        world.component<Transform>();
+        world.component<RigidBody>();
+        const int n = state.range(0);
+        for (int i = 0; i < n; ++i) {
+            world.entity().set<Transform>(bodyTransform(i)).set<RigidBody>(fallingBody());
+        }
+
+        auto q = world.query<Transform, RigidBody>();
+        for (auto _ : state) {
+            q.run([](flecs::iter& it) {
+                while (it.next()) {
+                    auto t = it.field<Transform>(0);
+                    auto rb = it.field<RigidBody>(1);
+                    simd::integrateRigidBodies(simd::Span<Transform>{ &t[0] }, simd::Span<RigidBody>{ &rb[0] }, it.count(), kDt);
+                }
+            });
+            benchmark::ClobberMemory();
+        }
+        state.SetLabel(simd::isa());
+    }
+
+    static void particle_system_simd(benchmark::State& state) {
+        flecs::world world;
+        world.component<Position>();
+        world.component<Velocity>();
+        const int n = state.range(0);
+        for (int i = 0; i < n; ++i) {
+            world.entity().set<Position>(particlePosition(i)).set<Velocity>(particleVelocity(i));
+        }
+
+        auto q = world.query<Position, Velocity>();
+        for (auto _ : state) {
+            q.run([](flecs::iter& it) {
+                while (it.next()) {
+                    auto p = it.field<Position>(0);
+                    auto v = it.field<Velocity>(1);
+                    simd::integrateParticles(simd::Span<Position>{ &p[0] }, simd::Span<Velocity>{ &v[0] }, it.count(), kDt);
+                }
+            });
+            benchmark::ClobberMemory();
+        }
+        state.SetLabel(simd::isa());
+    }
+} // namespace flecs_r
+} // namespace realistic
+
+REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, physics_integration_simd)
+REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, particle_system_simd)
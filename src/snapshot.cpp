@@ -0,0 +1,622 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "components.h"
+#include "registration.h"
+
+// Checkpoint / warm start of a Transform + RigidBody + Health world.
+//  snapshot_save_*  - world -> flat byte stream; bytes_per_second = stream bytes / save time
+//  snapshot_load_*  - stream -> fresh world; bytes_per_second = stream bytes / load time,
+//                     time_to_first_iteration_us = load + first read-only pass over the loaded world
+// ECSS:  save_sectors copies the Transform/RigidBody/Health sector memory in runs (layout recovered from the
+//        addresses view.each() hands out, stored in the stream header); _columns walks the entities once per
+//        component type. ECSS cannot adopt external memory as a sector, so load_sector_stream rebuilds the
+//        world from that stream with one addComponent per entity and component, like load_columns, and only
+//        the record layout it reads differs; its bytes_per_second is stream bytes consumed, not sector memory
+//        restored. _mapped maps the sector stream from a file and runs the first pass on it in place (page
+//        cache warm, no registry built).
+// EnTT:  entt::snapshot / entt::snapshot_loader with a raw binary archive.
+// flecs: world.to_json() / world.from_json() with reflection registered for the three components.
+// Entity ids are implicit in the ECSS streams (spawn order); fresh registries hand them out again in order.
+namespace {
+    constexpr float kDt = 1.f / 60.f;
+
+    Transform bodyTransform(int i) {
+        return Transform{ (float)i, (float)(i * 2), 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f };
+    }
+
+    RigidBody bodyMotion(int i) {
+        return RigidBody{ 1.f, 0.5f, (float)(i % 7), 0.f, -9.8f, 0.f, 1.f, 0.1f };
+    }
+
+    Health bodyHealth(int i) {
+        return Health{ 50.f + (float)(i % 50), 100.f, 1.f + (float)(i % 5), false };
+    }
+
+    // Read-only pass used as "first iteration" after a load
+    float inspect(const Transform& t, const RigidBody& rb, const Health& h) {
+        return t.x + t.y + t.z + (rb.vx + rb.vy + rb.vz) * kDt + h.current;
+    }
+
+    class ByteWriter {
+    public:
+        explicit ByteWriter(std::vector<std::byte>& out) : mOut(out) { mOut.clear(); }
+
+        void write(const void* data, size_t bytes) {
+            const size_t at = mOut.size();
+            mOut.resize(at + bytes);
+            std::memcpy(mOut.data() + at, data, bytes);
+        }
+
+        template <typename T>
+        void operator()(const T& value) { write(&value, sizeof(T)); }
+
+        // Reserves `bytes` and returns where they start (for block copies)
+        std::byte* grow(size_t bytes) {
+            const size_t at = mOut.size();
+            mOut.resize(at + bytes);
+            return mOut.data() + at;
+        }
+
+    private:
+        std::vector<std::byte>& mOut;
+    };
+
+    class ByteReader {
+    public:
+        ByteReader(const std::byte* data, size_t size) : mData(data), mSize(size) {}
+
+        // A read past the end zeroes `data` and leaves the reader at the end, so sizes read from a truncated
+        // stream come back as 0 and loaders stop
+        bool read(void* data, size_t bytes) {
+            if (bytes > remaining()) {
+                std::memset(data, 0, bytes);
+                mPos = mSize;
+                return false;
+            }
+            std::memcpy(data, mData + mPos, bytes);
+            mPos += bytes;
+            return true;
+        }
+
+        template <typename T>
+        bool operator()(T& value) { return read(&value, sizeof(T)); }
+
+        const std::byte* cursor() const { return mData + mPos; }
+        size_t remaining() const { return mSize - mPos; }
+
+    private:
+        const std::byte* mData;
+        size_t mSize;
+        size_t mPos = 0;
+    };
+
+    // Read-only mapping of a whole file
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+            mFile = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (mFile == INVALID_HANDLE_VALUE) {
+                return;
+            }
+            LARGE_INTEGER size;
+            GetFileSizeEx(mFile, &size);
+            mSize = static_cast<size_t>(size.QuadPart);
+            mMapping = CreateFileMappingW(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mMapping) {
+                mData = static_cast<const std::byte*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+            }
+#else
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                return;
+            }
+            struct stat st {};
+            if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+                mSize = static_cast<size_t>(st.st_size);
+                void* addr = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+                mData = addr == MAP_FAILED ? nullptr : static_cast<const std::byte*>(addr);
+            }
+            ::close(fd);
+#endif
+        }
+
+        ~MappedFile() {
+#ifdef _WIN32
+            if (mData) UnmapViewOfFile(mData);
+            if (mMapping) CloseHandle(mMapping);
+            if (mFile != INVALID_HANDLE_VALUE) CloseHandle(mFile);
+#else
+            if (mData) ::munmap(const_cast<std::byte*>(mData), mSize);
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        const std::byte* data() const { return mData; }
+        size_t size() const { return mSize; }
+
+    private:
+        const std::byte* mData = nullptr;
+        size_t mSize = 0;
+#ifdef _WIN32
+        HANDLE mFile = INVALID_HANDLE_VALUE;
+        HANDLE mMapping = nullptr;
+#endif
+    };
+
+    std::filesystem::path snapshotPath() {
+        return std::filesystem::temp_directory_path() / "ecss_benchmarks_snapshot.bin";
+    }
+
+    bool writeFile(const std::filesystem::path& path, const std::vector<std::byte>& bytes) {
+        FILE* f = std::fopen(path.string().c_str(), "wb");
+        if (!f) {
+            return false;
+        }
+        const bool ok = std::fwrite(bytes.data(), 1, bytes.size(), f) == bytes.size();
+        return std::fclose(f) == 0 && ok;
+    }
+
+    struct LoadStats {
+        double firstPassNs = 0.0;
+        double loadNs = 0.0;
+    };
+
+    void reportSave(benchmark::State& state, size_t streamBytes) {
+        state.counters["stream_bytes"] = benchmark::Counter(static_cast<double>(streamBytes), benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(streamBytes));
+    }
+
+    void reportLoad(benchmark::State& state, size_t streamBytes, const LoadStats& stats) {
+        const double loads = static_cast<double>(std::max<benchmark::IterationCount>(1, state.iterations()));
+        state.counters["time_to_first_iteration_us"] = (stats.loadNs + stats.firstPassNs) / loads / 1000.0;
+        reportSave(state, streamBytes);
+    }
+
+    // Times load() (returns the loaded world), then the first pass over it with the timer paused.
+    // The previous world is torn down untimed.
+    template <typename World, typename Load, typename FirstPass>
+    LoadStats timeLoads(benchmark::State& state, Load&& load, FirstPass&& firstPass) {
+        using Clock = std::chrono::steady_clock;
+        LoadStats stats;
+        std::optional<World> world;
+        for (auto _ : state) {
+            state.PauseTiming();
+            world.reset();
+            state.ResumeTiming();
+
+            const auto start = Clock::now();
+            load(world);
+            const auto loaded = Clock::now();
+
+            state.PauseTiming();
+            benchmark::DoNotOptimize(firstPass(*world));
+            stats.firstPassNs += std::chrono::duration<double, std::nano>(Clock::now() - loaded).count();
+            stats.loadNs += std::chrono::duration<double, std::nano>(loaded - start).count();
+            state.ResumeTiming();
+        }
+        state.PauseTiming();
+        world.reset();
+        state.ResumeTiming();
+        return stats;
+    }
+}
+
+namespace realistic {
+namespace ecss_r {
+    using Reg = ecss::Registry<false>;
+
+    static void spawnWorld(Reg& reg, int n) {
+        reg.registerArray<Transform, RigidBody, Health>();
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            reg.addComponent<Transform>(e, bodyTransform(i));
+            reg.addComponent<RigidBody>(e, bodyMotion(i));
+            reg.addComponent<Health>(e, bodyHealth(i));
+        }
+    }
+
+    // Sector image: stride and member offsets relative to the start of an entity's record
+    struct SectorLayout {
+        uint64_t entities = 0;
+        uint64_t stride = sizeof(Transform) + sizeof(RigidBody) + sizeof(Health);
+        uint64_t transform = 0;
+        uint64_t rigidBody = sizeof(Transform);
+        uint64_t health = sizeof(Transform) + sizeof(RigidBody);
+    };
+
+    static size_t recordBytes(const SectorLayout& layout) {
+        return std::max({ layout.transform + sizeof(Transform), layout.rigidBody + sizeof(RigidBody), layout.health + sizeof(Health) });
+    }
+
+    // Recovers the in-memory layout from the first two entities; falls back to a packed record
+    static SectorLayout probeLayout(Reg& reg) {
+        SectorLayout layout;
+        const std::byte* base[2] = {};
+        uint64_t offsets[3] = {};
+        bool valid = true;
+        reg.view<Transform, RigidBody, Health>().each([&](Transform& t, RigidBody& rb, Health& h) {
+            const auto* pt = reinterpret_cast<const std::byte*>(&t);
+            const auto* prb = reinterpret_cast<const std::byte*>(&rb);
+            const auto* ph = reinterpret_cast<const std::byte*>(&h);
+            const auto* lo = std::min({ pt, prb, ph });
+            if (layout.entities < 2) {
+                const uint64_t off[3] = { uint64_t(pt - lo), uint64_t(prb - lo), uint64_t(ph - lo) };
+                if (layout.entities == 0) {
+                    std::copy(off, off + 3, offsets);
+                } else {
+                    valid = valid && std::equal(off, off + 3, offsets);
+                }
+                base[layout.entities] = lo;
+            }
+            ++layout.entities;
+        });
+
+        const uint64_t entities = layout.entities;
+        if (entities >= 2 && valid && base[1] > base[0]) {
+            const uint64_t stride = static_cast<uint64_t>(base[1] - base[0]);
+            const SectorLayout probed{ entities, stride, offsets[0], offsets[1], offsets[2] };
+            if (stride >= recordBytes(probed)) {
+                layout = probed;
+            }
+        }
+        layout.entities = entities;
+        return layout;
+    }
+
+    // [SectorLayout][entities * stride]: runs of records that sit back to back in memory with the probed
+    // layout are copied with one memcpy, anything else is copied member by member into its record
+    static size_t saveSectors(Reg& reg, const SectorLayout& layout, std::vector<std::byte>& stream) {
+        ByteWriter out(stream);
+        out(layout);
+        std::byte* records = out.grow(layout.entities * layout.stride);
+
+        const std::byte* runStart = nullptr;
+        size_t runLength = 0;
+        size_t written = 0;
+        auto flush = [&] {
+            if (runLength) {
+                // The last record stops at its final member: the sector may end right after it
+                std::memcpy(records + written * layout.stride, runStart, (runLength - 1) * layout.stride + recordBytes(layout));
+                written += runLength;
+                runLength = 0;
+            }
+        };
+        reg.view<Transform, RigidBody, Health>().each([&](Transform& t, RigidBody& rb, Health& h) {
+            const auto* record = reinterpret_cast<const std::byte*>(&t) - layout.transform;
+            const bool inLayout = reinterpret_cast<const std::byte*>(&rb) == record + layout.rigidBody
+                && reinterpret_cast<const std::byte*>(&h) == record + layout.health;
+            if (inLayout && runLength && record == runStart + runLength * layout.stride) {
+                ++runLength;
+                return;
+            }
+            flush();
+            if (inLayout) {
+                runStart = record;
+                runLength = 1;
+                return;
+            }
+            std::byte* dst = records + written * layout.stride;
+            std::memcpy(dst + layout.transform, &t, sizeof(Transform));
+            std::memcpy(dst + layout.rigidBody, &rb, sizeof(RigidBody));
+            std::memcpy(dst + layout.health, &h, sizeof(Health));
+            ++written;
+        });
+        flush();
+        return stream.size();
+    }
+
+    // [entities][Transform column][RigidBody column][Health column], one view walk per component
+    static size_t saveColumns(Reg& reg, std::vector<std::byte>& stream) {
+        ByteWriter out(stream);
+        uint64_t entities = 0;
+        reg.view<Transform>().each([&](Transform&) { ++entities; });
+        out(entities);
+        reg.view<Transform>().each([&](Transform& t) { out(t); });
+        reg.view<RigidBody>().each([&](RigidBody& rb) { out(rb); });
+        reg.view<Health>().each([&](Health& h) { out(h); });
+        return stream.size();
+    }
+
+    template <typename T>
+    static T readAt(const std::byte* at) {
+        T value;
+        std::memcpy(&value, at, sizeof(T));
+        return value;
+    }
+
+    // Per-entity rebuild from the sector stream: one addComponent per entity and component
+    static void loadSectorStream(Reg& reg, const std::vector<std::byte>& stream) {
+        ByteReader in(stream.data(), stream.size());
+        SectorLayout layout;
+        reg.registerArray<Transform, RigidBody, Health>();
+        if (!in(layout) || layout.stride < recordBytes(layout) || layout.entities > in.remaining() / layout.stride) {
+            return;
+        }
+        const std::byte* records = in.cursor();
+        for (uint64_t i = 0; i < layout.entities; ++i) {
+            const std::byte* record = records + i * layout.stride;
+            auto e = reg.takeEntity();
+            reg.addComponent<Transform>(e, readAt<Transform>(record + layout.transform));
+            reg.addComponent<RigidBody>(e, readAt<RigidBody>(record + layout.rigidBody));
+            reg.addComponent<Health>(e, readAt<Health>(record + layout.health));
+        }
+    }
+
+    static void loadColumns(Reg& reg, const std::vector<std::byte>& stream) {
+        ByteReader in(stream.data(), stream.size());
+        uint64_t entities = 0;
+        reg.registerArray<Transform, RigidBody, Health>();
+        if (!in(entities) || entities > in.remaining() / (sizeof(Transform) + sizeof(RigidBody) + sizeof(Health))) {
+            return;
+        }
+        const std::byte* columns = in.cursor();
+        const std::byte* transforms = columns;
+        const std::byte* bodies = transforms + entities * sizeof(Transform);
+        const std::byte* healths = bodies + entities * sizeof(RigidBody);
+
+        std::vector<ecss::EntityId> ids(entities);
+        for (uint64_t i = 0; i < entities; ++i) {
+            ids[i] = reg.takeEntity();
+            reg.addComponent<Transform>(ids[i], readAt<Transform>(transforms + i * sizeof(Transform)));
+        }
+        for (uint64_t i = 0; i < entities; ++i) {
+            reg.addComponent<RigidBody>(ids[i], readAt<RigidBody>(bodies + i * sizeof(RigidBody)));
+        }
+        for (uint64_t i = 0; i < entities; ++i) {
+            reg.addComponent<Health>(ids[i], readAt<Health>(healths + i * sizeof(Health)));
+        }
+    }
+
+    static float firstPass(Reg& reg) {
+        float sum = 0.f;
+        reg.view<Transform, RigidBody, Health>().each([&](Transform& t, RigidBody& rb, Health& h) { sum += inspect(t, rb, h); });
+        return sum;
+    }
+
+    static void snapshot_save_sectors(benchmark::State& state) {
+        Reg reg;
+        spawnWorld(reg, state.range(0));
+        const SectorLayout layout = probeLayout(reg);
+        std::vector<std::byte> stream;
+        size_t bytes = 0;
+        for (auto _ : state) {
+            bytes = saveSectors(reg, layout, stream);
+            benchmark::DoNotOptimize(stream.data());
+        }
+        state.counters["sector_stride"] = static_cast<double>(layout.stride);
+        reportSave(state, bytes);
+    }
+
+    static void snapshot_save_columns(benchmark::State& state) {
+        Reg reg;
+        spawnWorld(reg, state.range(0));
+        std::vector<std::byte> stream;
+        size_t bytes = 0;
+        for (auto _ : state) {
+            bytes = saveColumns(reg, stream);
+            benchmark::DoNotOptimize(stream.data());
+        }
+        reportSave(state, bytes);
+    }
+
+    static void snapshot_load_sector_stream(benchmark::State& state) {
+        std::vector<std::byte> stream;
+        {
+            Reg reg;
+            spawnWorld(reg, state.range(0));
+            saveSectors(reg, probeLayout(reg), stream);
+        }
+        const LoadStats stats = timeLoads<Reg>(state, [&](std::optional<Reg>& reg) { loadSectorStream(reg.emplace(), stream); }, firstPass);
+        reportLoad(state, stream.size(), stats);
+    }
+
+    static void snapshot_load_columns(benchmark::State& state) {
+        std::vector<std::byte> stream;
+        {
+            Reg reg;
+            spawnWorld(reg, state.range(0));
+            saveColumns(reg, stream);
+        }
+        const LoadStats stats = timeLoads<Reg>(state, [&](std::optional<Reg>& reg) { loadColumns(reg.emplace(), stream); }, firstPass);
+        reportLoad(state, stream.size(), stats);
+    }
+
+    // Map the sector stream and iterate the records where they are
+    static void snapshot_load_mapped(benchmark::State& state) {
+        const auto path = snapshotPath();
+        size_t bytes = 0;
+        {
+            Reg reg;
+            spawnWorld(reg, state.range(0));
+            std::vector<std::byte> stream;
+            bytes = saveSectors(reg, probeLayout(reg), stream);
+            if (!writeFile(path, stream)) {
+                state.SkipWithError("cannot write the snapshot file");
+                return;
+            }
+        }
+
+        const LoadStats stats = timeLoads<MappedFile>(state,
+            [&](std::optional<MappedFile>& file) { file.emplace(path); },
+            [](const MappedFile& file) {
+                float sum = 0.f;
+                if (!file.data() || file.size() < sizeof(SectorLayout)) {
+                    return sum;
+                }
+                // Same header checks as loadSectorStream: a truncated or stale file must not be walked past its end
+                const SectorLayout layout = readAt<SectorLayout>(file.data());
+                if (layout.stride < recordBytes(layout) || layout.entities > (file.size() - sizeof(SectorLayout)) / layout.stride) {
+                    return sum;
+                }
+                const std::byte* records = file.data() + sizeof(SectorLayout);
+                for (uint64_t i = 0; i < layout.entities; ++i) {
+                    const std::byte* record = records + i * layout.stride;
+                    sum += inspect(*reinterpret_cast<const Transform*>(record + layout.transform),
+                        *reinterpret_cast<const RigidBody*>(record + layout.rigidBody),
+                        *reinterpret_cast<const Health*>(record + layout.health));
+                }
+                return sum;
+            });
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        reportLoad(state, bytes, stats);
+    }
+} // namespace ecss_r
+
+namespace entt_r {
+    static void spawnWorld(entt::registry& reg, int n) {
+        std::vector<entt::entity> ids(n);
+        reg.create(ids.begin(), ids.end());
+        for (int i = 0; i < n; ++i) {
+            reg.emplace<Transform>(ids[i], bodyTransform(i));
+            reg.emplace<RigidBody>(ids[i], bodyMotion(i));
+            reg.emplace<Health>(ids[i], bodyHealth(i));
+        }
+    }
+
+    static size_t save(const entt::registry& reg, std::vector<std::byte>& stream) {
+        ByteWriter out(stream);
+        entt::snapshot{ reg }
+            .get<entt::entity>(out)
+            .get<Transform>(out)
+            .get<RigidBody>(out)
+            .get<Health>(out);
+        return stream.size();
+    }
+
+    static float firstPass(entt::registry& reg) {
+        float sum = 0.f;
+        reg.view<const Transform, const RigidBody, const Health>().each([&](const Transform& t, const RigidBody& rb, const Health& h) { sum += inspect(t, rb, h); });
+        return sum;
+    }
+
+    static void snapshot_save(benchmark::State& state) {
+        entt::registry reg;
+        spawnWorld(reg, state.range(0));
+        std::vector<std::byte> stream;
+        size_t bytes = 0;
+        for (auto _ : state) {
+            bytes = save(reg, stream);
+            benchmark::DoNotOptimize(stream.data());
+        }
+        reportSave(state, bytes);
+    }
+
+    static void snapshot_load(benchmark::State& state) {
+        std::vector<std::byte> stream;
+        {
+            entt::registry reg;
+            spawnWorld(reg, state.range(0));
+            save(reg, stream);
+        }
+        const LoadStats stats = timeLoads<entt::registry>(state, [&](std::optional<entt::registry>& reg) {
+            ByteReader in(stream.data(), stream.size());
+            entt::snapshot_loader{ reg.emplace() }
+                .get<entt::entity>(in)
+                .get<Transform>(in)
+                .get<RigidBody>(in)
+                .get<Health>(in)
+                .orphans();
+        }, firstPass);
+        reportLoad(state, stream.size(), stats);
+    }
+} // namespace entt_r
+
+namespace flecs_r {
+    // JSON (de)serialization goes through the reflection data
+    static void registerReflection(flecs::world& world) {
+        world.component<Transform>()
+            .member<float>("x").member<float>("y").member<float>("z")
+            .member<float>("rx").member<float>("ry").member<float>("rz").member<float>("rw")
+            .member<float>("sx").member<float>("sy").member<float>("sz");
+        world.component<RigidBody>()
+            .member<float>("vx").member<float>("vy").member<float>("vz")
+            .member<float>("ax").member<float>("ay").member<float>("az")
+            .member<float>("mass").member<float>("drag");
+        world.component<Health>()
+            .member<float>("current").member<float>("max").member<float>("regen").member<bool>("isDead");
+    }
+
+    static void spawnWorld(flecs::world& world, int n) {
+        registerReflection(world);
+        for (int i = 0; i < n; ++i) {
+            world.entity().set<Transform>(bodyTransform(i)).set<RigidBody>(bodyMotion(i)).set<Health>(bodyHealth(i));
+        }
+    }
+
+    static float firstPass(flecs::world& world) {
+        float sum = 0.f;
+        world.query<const Transform, const RigidBody, const Health>().each([&](const Transform& t, const RigidBody& rb, const Health& h) { sum += inspect(t, rb, h); });
+        return sum;
+    }
+
+    static void snapshot_save(benchmark::State& state) {
+        flecs::world world;
+        spawnWorld(world, state.range(0));
+        size_t bytes = 0;
+        for (auto _ : state) {
+            flecs::string json = world.to_json();
+            bytes = json.size();
+            benchmark::DoNotOptimize(json.c_str());
+        }
+        reportSave(state, bytes);
+    }
+
+    static void snapshot_load(benchmark::State& state) {
+        std::string json;
+        {
+            flecs::world world;
+            spawnWorld(world, state.range(0));
+            json = world.to_json().c_str();
+        }
+        const LoadStats stats = timeLoads<flecs::world>(state, [&](std::optional<flecs::world>& world) {
+            registerReflection(world.emplace());
+            world->from_json(json.c_str());
+        }, firstPass);
+        reportLoad(state, json.size(), stats);
+    }
+} // namespace flecs_r
+} // namespace realistic
+
+// realistic/<ecs>/snapshot_*/<entities>
+#define BENCH_SNAPSHOT_ONE(ECS, FUNC) \
+    BENCHMARK(memtrack::tracked<realistic::ECS::FUNC>)->Name("realistic/" #ECS "/" #FUNC) \
+        ->Unit(benchmark::TimeUnit::kMillisecond)->Arg(100000)->Arg(1000000)->MinTime(0.3);
+
+BENCH_SNAPSHOT_ONE(ecss_r, snapshot_save_sectors)
+BENCH_SNAPSHOT_ONE(ecss_r, snapshot_save_columns)
+BENCH_SNAPSHOT_ONE(ecss_r, snapshot_load_sector_stream)
+BENCH_SNAPSHOT_ONE(ecss_r, snapshot_load_columns)
+BENCH_SNAPSHOT_ONE(ecss_r, snapshot_load_mapped)
+BENCH_SNAPSHOT_ONE(entt_r, snapshot_save)
+BENCH_SNAPSHOT_ONE(entt_r, snapshot_load)
+BENCH_SNAPSHOT_ONE(flecs_r, snapshot_save)
+BENCH_SNAPSHOT_ONE(flecs_r, snapshot_load)
@@ -0,0 +1,141 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <type_traits>
+
+#include "components.h"
+#include "registration.h"
+
+// physics_integration over a field-split layout. The AoS rows are realistic/<ecs>/physics_integration:
+// Transform (40 B) + RigidBody (32 B) per entity, of which the integration reads 40 B.
+// Here every field group is its own component, so the view only streams the hot ones:
+//  physics_integration_soa     - each component in its own storage (arrays / pools / table columns)
+//  physics_integration_soa_hot - hot components stored together: an ECSS sector of the four hot
+//                                components (cold ones in a second array), an EnTT owning group
+// Same initial values and math as the AoS rows, so the results compare directly.
+namespace {
+    // Hot: read or written by the integration
+    struct Translation { float x, y, z; };
+    struct LinearVelocity { float vx, vy, vz; };
+    struct Acceleration { float ax, ay, az; };
+    struct Drag { float drag; };
+
+    // Cold: carried by the entity, not touched by the frame
+    struct Rotation { float rx, ry, rz, rw; };
+    struct Scale { float sx, sy, sz; };
+    struct Mass { float mass; };
+
+    constexpr float kDt = 1.f / 60.f;
+
+    void integrate(Translation& t, LinearVelocity& v, const Acceleration& a, const Drag& d, float dt) {
+        v.vx += a.ax * dt;
+        v.vy += a.ay * dt;
+        v.vz += a.az * dt;
+
+        v.vx *= (1.f - d.drag * dt);
+        v.vy *= (1.f - d.drag * dt);
+        v.vz *= (1.f - d.drag * dt);
+
+        t.x += v.vx * dt;
+        t.y += v.vy * dt;
+        t.z += v.vz * dt;
+    }
+
+    // Component values matching the AoS Transform / RigidBody of physics_integration
+    template <typename Emplace>
+    void spawnBody(int i, Emplace&& emplace) {
+        emplace(Translation{ (float)i, (float)(i * 2), 0.f });
+        emplace(Rotation{ 0.f, 0.f, 0.f, 1.f });
+        emplace(Scale{ 1.f, 1.f, 1.f });
+        emplace(LinearVelocity{ 1.f, 0.5f, 0.f });
+        emplace(Acceleration{ 0.f, -9.8f, 0.f });
+        emplace(Mass{ 1.f });
+        emplace(Drag{ 0.1f });
+    }
+}
+
+namespace realistic {
+namespace ecss_r {
+    using Reg = ecss::Registry<false>;
+
+    template <bool HotSector>
+    static void physicsIntegrationSplit(benchmark::State& state) {
+        Reg reg;
+        if constexpr (HotSector) {
+            reg.registerArray<Translation, LinearVelocity, Acceleration, Drag>();
+            reg.registerArray<Rotation, Scale, Mass>();
+        }
+        const int n = state.range(0);
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            spawnBody(i, [&](auto&& component) { reg.addComponent<std::decay_t<decltype(component)>>(e, component); });
+        }
+
+        auto view = reg.view<Translation, LinearVelocity, Acceleration, Drag>();
+        for (auto _ : state) {
+            view.each([](Translation& t, LinearVelocity& v, Acceleration& a, Drag& d) { integrate(t, v, a, d, kDt); });
+            benchmark::ClobberMemory();
+        }
+    }
+
+    static void physics_integration_soa(benchmark::State& state) { physicsIntegrationSplit<false>(state); }
+    static void physics_integration_soa_hot(benchmark::State& state) { physicsIntegrationSplit<true>(state); }
+} // namespace ecss_r
+
+namespace entt_r {
+    static void physics_integration_soa(benchmark::State& state) {
+        entt::registry reg;
+        const int n = state.range(0);
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.create();
+            spawnBody(i, [&](auto&& component) { reg.emplace<std::decay_t<decltype(component)>>(e, component); });
+        }
+
+        auto view = reg.view<Translation, LinearVelocity, const Acceleration, const Drag>();
+        for (auto _ : state) {
+            view.each([](Translation& t, LinearVelocity& v, const Acceleration& a, const Drag& d) { integrate(t, v, a, d, kDt); });
+            benchmark::ClobberMemory();
+        }
+    }
+
+    // Owning group: the four hot pools are packed in the same order, iteration is a linear walk
+    static void physics_integration_soa_hot(benchmark::State& state) {
+        entt::registry reg;
+        auto group = reg.group<Translation, LinearVelocity, Acceleration, Drag>();
+        const int n = state.range(0);
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.create();
+            spawnBody(i, [&](auto&& component) { reg.emplace<std::decay_t<decltype(component)>>(e, component); });
+        }
+
+        for (auto _ : state) {
+            group.each([](Translation& t, LinearVelocity& v, Acceleration& a, Drag& d) { integrate(t, v, a, d, kDt); });
+            benchmark::ClobberMemory();
+        }
+    }
+} // namespace entt_r
+
+namespace flecs_r {
+    // Archetype tables are already columnar; the query just selects the four hot columns
+    static void physics_integration_soa(benchmark::State& state) {
+        flecs::world world;
+        const int n = state.range(0);
+        for (int i = 0; i < n; ++i) {
+            auto e = world.entity();
+            spawnBody(i, [&](auto&& component) { e.set<std::decay_t<decltype(component)>>(component); });
+        }
+
+        auto q = world.query<Translation, LinearVelocity, const Acceleration, const Drag>();
+        for (auto _ : state) {
+            q.each([](Translation& t, LinearVelocity& v, const Acceleration& a, const Drag& d) { integrate(t, v, a, d, kDt); });
+            benchmark::ClobberMemory();
+        }
+    }
+} // namespace flecs_r
+} // namespace realistic
+
+REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, physics_integration_soa)
+BENCH_REALISTIC_ARGS(BENCH_REALISTIC_ONE, ecss_r, physics_integration_soa_hot)
+BENCH_REALISTIC_ARGS(BENCH_REALISTIC_ONE, entt_r, physics_integration_soa_hot)
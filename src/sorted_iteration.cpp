@@ -0,0 +1,307 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "components.h"
+#include "registration.h"
+
+// Render-order sprites: Transform + Sprite with random (layer, textureId), consumed sorted by that key.
+//  sprite_sort               - full sort from an unsorted world
+//  sprite_sorted_iterate     - quad generation in sorted order; draw_calls = (layer, texture) switches
+//  sprite_resort_incremental - 1% of the sprites change layer, then the order is restored
+// The sort and the pass are separate rows; flecs sorts when iteration starts, so its sort rows include one pass.
+namespace {
+    constexpr uint32_t kSpriteSeed = 0x5B17;
+    constexpr int kLayers = 16;
+    constexpr uint32_t kTextures = 256;
+
+    struct BatchVertex { float x, y, u, v; uint32_t color; };
+
+    uint64_t sortKey(const Sprite& s) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(s.layer)) << 32) | s.textureId;
+    }
+
+    Transform spriteTransform(int i) {
+        return Transform{ (float)(i % 1920), (float)((i / 1920) % 1080), 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f };
+    }
+
+    Sprite randomSprite(std::mt19937& rng) {
+        return Sprite{ rng() % kTextures, 0.f, 0.f, 1.f, 1.f, 0xFFFFFFFF, static_cast<int>(rng() % kLayers) };
+    }
+
+    // Emits one quad and counts a draw call whenever the (layer, texture) key changes
+    struct QuadBatcher {
+        std::vector<BatchVertex> batch;
+        uint64_t lastKey = UINT64_MAX;
+        int64_t drawCalls = 0;
+
+        explicit QuadBatcher(size_t sprites) { batch.reserve(sprites * 4); }
+
+        void begin() {
+            batch.clear();
+            lastKey = UINT64_MAX;
+            drawCalls = 0;
+        }
+
+        void push(const Transform& t, const Sprite& s) {
+            const uint64_t key = sortKey(s);
+            drawCalls += key != lastKey;
+            lastKey = key;
+            batch.push_back({ t.x,        t.y,        s.u0, s.v0, s.color });
+            batch.push_back({ t.x + t.sx, t.y,        s.u1, s.v0, s.color });
+            batch.push_back({ t.x + t.sx, t.y + t.sy, s.u1, s.v1, s.color });
+            batch.push_back({ t.x,        t.y + t.sy, s.u0, s.v1, s.color });
+        }
+    };
+
+    size_t changedPerFrame(size_t n) {
+        return std::max<size_t>(1, n / 100);
+    }
+}
+
+namespace realistic {
+namespace ecss_r {
+    using Reg = ecss::Registry<false>;
+    using SortIndex = std::vector<std::pair<uint64_t, ecss::EntityId>>;
+
+    // ECSS has no storage reorder: the render order is a (key, id) index sorted next to the registry
+    // and the pass goes through getComponent
+    struct SpriteWorld {
+        Reg reg;
+        SortIndex index;
+
+        explicit SpriteWorld(int n) {
+            std::mt19937 rng(kSpriteSeed);
+            reg.registerArray<Transform, Sprite>();
+            index.reserve(n);
+            for (int i = 0; i < n; ++i) {
+                auto e = reg.takeEntity();
+                reg.addComponent<Transform>(e, spriteTransform(i));
+                const Sprite s = randomSprite(rng);
+                reg.addComponent<Sprite>(e, s);
+                index.emplace_back(sortKey(s), e);
+            }
+        }
+
+        void sort() {
+            std::sort(index.begin(), index.end());
+        }
+    };
+
+    static void sprite_sort(benchmark::State& state) {
+        SpriteWorld world(state.range(0));
+        const SortIndex unsorted = world.index;
+        for (auto _ : state) {
+            state.PauseTiming();
+            world.index = unsorted;
+            state.ResumeTiming();
+            world.sort();
+            benchmark::DoNotOptimize(world.index.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    static void sprite_sorted_iterate(benchmark::State& state) {
+        SpriteWorld world(state.range(0));
+        world.sort();
+        QuadBatcher batcher(world.index.size());
+        for (auto _ : state) {
+            batcher.begin();
+            for (const auto& [key, e] : world.index) {
+                batcher.push(*world.reg.getComponent<Transform>(e), *world.reg.getComponent<Sprite>(e));
+            }
+            benchmark::DoNotOptimize(batcher.batch.data());
+        }
+        state.counters["draw_calls"] = static_cast<double>(batcher.drawCalls);
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // Re-key the changed entries in place, then insertion-sort the nearly sorted index
+    static void sprite_resort_incremental(benchmark::State& state) {
+        SpriteWorld world(state.range(0));
+        world.sort();
+        std::mt19937 rng(kSpriteSeed + 1);
+        const size_t changed = changedPerFrame(world.index.size());
+        for (auto _ : state) {
+            for (size_t i = 0; i < changed; ++i) {
+                auto& entry = world.index[rng() % world.index.size()];
+                auto* sprite = world.reg.getComponent<Sprite>(entry.second);
+                sprite->layer = static_cast<int>(rng() % kLayers);
+                entry.first = sortKey(*sprite);
+            }
+            for (auto it = world.index.begin() + 1; it < world.index.end(); ++it) {
+                if (*it < *(it - 1)) {
+                    std::rotate(std::upper_bound(world.index.begin(), it, *it), it, it + 1);
+                }
+            }
+            benchmark::DoNotOptimize(world.index.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(changed));
+    }
+} // namespace ecss_r
+
+namespace entt_r {
+    struct SpriteWorld {
+        entt::registry reg;
+
+        explicit SpriteWorld(int n) {
+            std::mt19937 rng(kSpriteSeed);
+            for (int i = 0; i < n; ++i) {
+                auto e = reg.create();
+                reg.emplace<Transform>(e, spriteTransform(i));
+                reg.emplace<Sprite>(e, randomSprite(rng));
+            }
+        }
+
+        template <typename Algo = entt::std_sort>
+        void sort(Algo algo = {}) {
+            reg.sort<Sprite>([](const Sprite& lhs, const Sprite& rhs) { return sortKey(lhs) < sortKey(rhs); }, algo);
+            reg.sort<Transform, Sprite>();
+        }
+
+        // Back to an unsorted pool order (creation order)
+        void unsort() {
+            reg.sort<Sprite>([](entt::entity lhs, entt::entity rhs) { return entt::to_integral(lhs) < entt::to_integral(rhs); });
+            reg.sort<Transform, Sprite>();
+        }
+    };
+
+    static void sprite_sort(benchmark::State& state) {
+        SpriteWorld world(state.range(0));
+        for (auto _ : state) {
+            state.PauseTiming();
+            world.unsort();
+            state.ResumeTiming();
+            world.sort();
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    static void sprite_sorted_iterate(benchmark::State& state) {
+        SpriteWorld world(state.range(0));
+        world.sort();
+        auto& sprites = world.reg.storage<Sprite>();
+        auto& transforms = world.reg.storage<Transform>();
+        QuadBatcher batcher(sprites.size());
+        for (auto _ : state) {
+            batcher.begin();
+            for (auto [e, s] : sprites.each()) {
+                batcher.push(transforms.get(e), s);
+            }
+            benchmark::DoNotOptimize(batcher.batch.data());
+        }
+        state.counters["draw_calls"] = static_cast<double>(batcher.drawCalls);
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // patch() the changed sprites, then insertion_sort the nearly sorted pool and realign Transform
+    static void sprite_resort_incremental(benchmark::State& state) {
+        SpriteWorld world(state.range(0));
+        world.sort();
+        std::mt19937 rng(kSpriteSeed + 1);
+        auto& sprites = world.reg.storage<Sprite>();
+        const size_t changed = changedPerFrame(sprites.size());
+        for (auto _ : state) {
+            for (size_t i = 0; i < changed; ++i) {
+                const auto e = sprites.data()[rng() % sprites.size()];
+                world.reg.patch<Sprite>(e, [&](Sprite& s) { s.layer = static_cast<int>(rng() % kLayers); });
+            }
+            world.sort(entt::insertion_sort{});
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(changed));
+    }
+} // namespace entt_r
+
+namespace flecs_r {
+    static int compareSprites(flecs::entity_t, const Sprite* lhs, flecs::entity_t, const Sprite* rhs) {
+        const uint64_t a = sortKey(*lhs), b = sortKey(*rhs);
+        return (a > b) - (a < b);
+    }
+
+    struct SpriteWorld {
+        flecs::world world;
+        std::vector<flecs::entity> entities;
+
+        explicit SpriteWorld(int n) {
+            std::mt19937 rng(kSpriteSeed);
+            world.component<Transform>();
+            world.component<Sprite>();
+            entities.reserve(n);
+            for (int i = 0; i < n; ++i) {
+                entities.push_back(world.entity().set<Transform>(spriteTransform(i)).set<Sprite>(randomSprite(rng)));
+            }
+        }
+
+        flecs::query<const Transform, const Sprite> sortedQuery() {
+            return world.query_builder<const Transform, const Sprite>()
+                .order_by<Sprite>(compareSprites)
+                .build();
+        }
+    };
+
+    // Builds the order_by query and runs the pass that performs the sort
+    static void sprite_sort(benchmark::State& state) {
+        SpriteWorld world(state.range(0));
+        QuadBatcher batcher(world.entities.size());
+        for (auto _ : state) {
+            auto q = world.sortedQuery();
+            batcher.begin();
+            q.each([&](const Transform& t, const Sprite& s) { batcher.push(t, s); });
+            benchmark::DoNotOptimize(batcher.batch.data());
+            state.PauseTiming();
+            q.destruct();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    static void sprite_sorted_iterate(benchmark::State& state) {
+        SpriteWorld world(state.range(0));
+        auto q = world.sortedQuery();
+        QuadBatcher batcher(world.entities.size());
+        q.each([&](const Transform& t, const Sprite& s) { batcher.push(t, s); }); // first pass sorts
+        for (auto _ : state) {
+            batcher.begin();
+            q.each([&](const Transform& t, const Sprite& s) { batcher.push(t, s); });
+            benchmark::DoNotOptimize(batcher.batch.data());
+        }
+        state.counters["draw_calls"] = static_cast<double>(batcher.drawCalls);
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // set() marks the table dirty, the next pass re-sorts it (pass included)
+    static void sprite_resort_incremental(benchmark::State& state) {
+        SpriteWorld world(state.range(0));
+        auto q = world.sortedQuery();
+        QuadBatcher batcher(world.entities.size());
+        q.each([&](const Transform& t, const Sprite& s) { batcher.push(t, s); });
+        std::mt19937 rng(kSpriteSeed + 1);
+        const size_t changed = changedPerFrame(world.entities.size());
+        for (auto _ : state) {
+            for (size_t i = 0; i < changed; ++i) {
+                auto e = world.entities[rng() % world.entities.size()];
+                Sprite s = *e.try_get<Sprite>();
+                s.layer = static_cast<int>(rng() % kLayers);
+                e.set<Sprite>(s);
+            }
+            batcher.begin();
+            q.each([&](const Transform& t, const Sprite& s) { batcher.push(t, s); });
+            benchmark::DoNotOptimize(batcher.batch.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(changed));
+    }
+} // namespace flecs_r
+} // namespace realistic
+
+REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, sprite_sort)
+REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, sprite_sorted_iterate)
+REGISTER_REALISTIC(ecss_r, entt_r, flecs_r, sprite_resort_incremental)
@@ -0,0 +1,289 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+#include "components.h"
+#include "perf_counters.h"
+#include "registration.h"
+
+// iter_sparse_multi with the intersection shape as parameters: all entities have Position, the matching
+// ones also have Velocity, and Position + Velocity is iterated.
+//  range(0) = entities
+//  range(1) = permille matching (1 = 0.1% ... 500 = 50%; iter_sparse_multi is a fixed 20, every 50th)
+//  range(2) = cluster length: matches come in runs of that many consecutive entities, the runs placed
+//             uniformly at random (1 = scattered, 256 = long runs, e.g. one spawn wave)
+// Rows per ECS:
+//  iter_sparse_select          - the library's own view/query (ECSS view<Velocity, Position>, EnTT sparse-set
+//                                intersection driven by the smaller set, flecs archetype match)
+//  iter_sparse_select_prefetch - ECSS, walking the ids of the Velocity set kept at spawn time through a software
+//                                pipeline kBatch entities deep: stage 1 looks up the linear slots of the newest
+//                                entity and prefetches its Position/Velocity sectors, stage 2 checks and
+//                                consumes the entity pushed kBatch steps earlier, whose lines are by then in flight
+// items_per_second and the perf counters are per matching entity.
+namespace {
+    constexpr uint32_t kSparseSeed = 0x5A17;
+    constexpr size_t kBatch = 32;
+
+    inline void prefetch(const void* ptr) {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_prefetch(static_cast<const char*>(ptr), _MM_HINT_T0);
+#elif defined(_MSC_VER)
+        (void)ptr;
+#else
+        __builtin_prefetch(ptr);
+#endif
+    }
+
+    // Ascending indices of the matching entities: ceil(n * permille / 1000) of them, in runs of `cluster`
+    std::vector<uint32_t> matchingIndices(size_t n, size_t permille, size_t cluster) {
+        const size_t matches = std::max<size_t>(1, (n * permille + 999) / 1000);
+        const size_t slots = n / cluster;
+        std::vector<uint32_t> slotOrder(slots);
+        std::iota(slotOrder.begin(), slotOrder.end(), 0u);
+        std::mt19937 rng(kSparseSeed);
+        std::shuffle(slotOrder.begin(), slotOrder.end(), rng);
+        slotOrder.resize(std::min(slots, (matches + cluster - 1) / cluster));
+        std::sort(slotOrder.begin(), slotOrder.end());
+
+        std::vector<uint32_t> indices;
+        indices.reserve(matches);
+        for (auto slot : slotOrder) {
+            for (size_t k = 0; k < cluster && indices.size() < matches; ++k) {
+                indices.push_back(static_cast<uint32_t>(slot * cluster + k));
+            }
+        }
+        return indices;
+    }
+
+    float kernel(const Position& p, const Velocity& v) {
+        return p.x + p.y + p.z + v.vx + v.vy + v.vz;
+    }
+
+    // Two-stage pipeline over entity ids: push() locates and prefetches the new entity's Position and
+    // Velocity sectors, and consumes the entity pushed kBatch calls earlier; take() drains the rest
+    template <typename Reg>
+    class PipelinedJoin {
+    public:
+        explicit PipelinedJoin(Reg& reg)
+            : mPositions(reg.template getComponentContainer<Position>())
+            , mVelocities(reg.template getComponentContainer<Velocity>())
+            , mPositionLayout(mPositions->template getLayoutData<Position>())
+            , mVelocityLayout(mVelocities->template getLayoutData<Velocity>()) {}
+
+        void push(ecss::EntityId id) {
+            Pending& slot = mRing[mNext];
+            if (mFill == kBatch) {
+                consume(slot);
+            } else {
+                ++mFill;
+            }
+            slot = Pending{ locate(mPositions, mPositionLayout, id), locate(mVelocities, mVelocityLayout, id) };
+            mNext = (mNext + 1) % kBatch;
+        }
+
+        float take() {
+            for (size_t i = (mNext + kBatch - mFill) % kBatch; mFill > 0; i = (i + 1) % kBatch, --mFill) {
+                consume(mRing[i]);
+            }
+            mNext = 0;
+            return std::exchange(mAccum, 0.f);
+        }
+
+    private:
+        using Container = std::remove_pointer_t<decltype(std::declval<Reg&>().template getComponentContainer<Position>())>;
+        using Layout = std::remove_cvref_t<decltype(std::declval<Container&>().template getLayoutData<Position>())>;
+
+        struct Target {
+            size_t idx = ecss::INVALID_IDX;
+            const std::byte* member = nullptr;
+        };
+
+        struct Pending {
+            Target position;
+            Target velocity;
+        };
+
+        // Stage 1: slot lookup and address only, the sector itself is not touched
+        static Target locate(Container* container, const Layout& layout, ecss::EntityId id) {
+            const auto idx = container->template findLinearIdx<false>(id);
+            if (idx == ecss::INVALID_IDX) {
+                return {};
+            }
+            const std::byte* member = container->template at<false>(idx) + layout.offset;
+            prefetch(member);
+            return Target{ idx, member };
+        }
+
+        bool alive(Container* container, const Layout& layout, const Target& target) const {
+            return target.member && ecss::Memory::Sector::isAlive(container->template getIsAliveRef<false>(target.idx), layout.isAliveMask);
+        }
+
+        // Stage 2
+        void consume(const Pending& pending) {
+            if (alive(mPositions, mPositionLayout, pending.position) && alive(mVelocities, mVelocityLayout, pending.velocity)) {
+                mAccum += kernel(*reinterpret_cast<const Position*>(pending.position.member), *reinterpret_cast<const Velocity*>(pending.velocity.member));
+            }
+        }
+
+        Container* mPositions;
+        Container* mVelocities;
+        const Layout& mPositionLayout;
+        const Layout& mVelocityLayout;
+        std::array<Pending, kBatch> mRing{};
+        size_t mNext = 0;
+        size_t mFill = 0;
+        float mAccum = 0.f;
+    };
+
+    struct Shape {
+        size_t entities;
+        std::vector<uint32_t> matching;
+    };
+
+    Shape shapeOf(const benchmark::State& state) {
+        const auto n = static_cast<size_t>(state.range(0));
+        return Shape{ n, matchingIndices(n, static_cast<size_t>(state.range(1)), static_cast<size_t>(state.range(2))) };
+    }
+
+    template <typename Frame>
+    void runFrames(benchmark::State& state, const Shape& shape, Frame&& frame) {
+        const auto matches = static_cast<int64_t>(shape.matching.size());
+        PERF_ENTITY_COUNTERS(state, matches);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(frame());
+        }
+        state.SetItemsProcessed(state.iterations() * matches);
+        state.counters["matches"] = static_cast<double>(matches);
+    }
+
+    enum class EcssPath { View, Prefetch };
+
+    template <bool ThreadSafe, EcssPath Path>
+    void ecssSparse(benchmark::State& state) {
+        using Reg = ecss::Registry<ThreadSafe>;
+        Reg reg;
+        const Shape shape = shapeOf(state);
+        std::vector<ecss::EntityId> ids;
+        ids.reserve(shape.entities);
+        for (size_t i = 0; i < shape.entities; ++i) {
+            auto e = reg.takeEntity();
+            reg.template addComponent<Position>(e, Position{ (float)i, (float)i + 1.f, (float)i + 2.f });
+            ids.push_back(e);
+        }
+        std::vector<ecss::EntityId> moving;
+        moving.reserve(shape.matching.size());
+        for (auto i : shape.matching) {
+            reg.template addComponent<Velocity>(ids[i], Velocity{ (float)i * 0.5f, (float)i * 0.25f, (float)i * 0.125f });
+            moving.push_back(ids[i]);
+        }
+
+        if constexpr (Path == EcssPath::View) {
+            auto view = reg.template view<Velocity, Position>();
+            runFrames(state, shape, [&] {
+                float accum = 0.f;
+                view.each([&](Velocity& v, Position& p) { accum += kernel(p, v); });
+                return accum;
+            });
+        } else {
+            PipelinedJoin<Reg> join(reg);
+            runFrames(state, shape, [&] {
+                for (auto e : moving) {
+                    join.push(e);
+                }
+                return join.take();
+            });
+        }
+    }
+
+    void enttSparse(benchmark::State& state) {
+        entt::registry reg;
+        const Shape shape = shapeOf(state);
+        std::vector<entt::entity> ids(shape.entities);
+        reg.create(ids.begin(), ids.end());
+        for (size_t i = 0; i < shape.entities; ++i) {
+            reg.emplace<Position>(ids[i], Position{ (float)i, (float)i + 1.f, (float)i + 2.f });
+        }
+        for (auto i : shape.matching) {
+            reg.emplace<Velocity>(ids[i], Velocity{ (float)i * 0.5f, (float)i * 0.25f, (float)i * 0.125f });
+        }
+
+        auto view = reg.view<Position, Velocity>();
+        runFrames(state, shape, [&] {
+            float accum = 0.f;
+            view.each([&](Position& p, Velocity& v) { accum += kernel(p, v); });
+            return accum;
+        });
+    }
+
+    void flecsSparse(benchmark::State& state) {
+        flecs::world world;
+        world.component<Position>();
+        world.component<Velocity>();
+        const Shape shape = shapeOf(state);
+        std::vector<flecs::entity> ids;
+        ids.reserve(shape.entities);
+        for (size_t i = 0; i < shape.entities; ++i) {
+            ids.push_back(world.entity().set<Position>({ (float)i, (float)i + 1.f, (float)i + 2.f }));
+        }
+        for (auto i : shape.matching) {
+            ids[i].set<Velocity>({ (float)i * 0.5f, (float)i * 0.25f, (float)i * 0.125f });
+        }
+
+        auto q = world.query<Position, Velocity>();
+        runFrames(state, shape, [&] {
+            float accum = 0.f;
+            q.each([&](Position& p, Velocity& v) { accum += kernel(p, v); });
+            return accum;
+        });
+        q.destruct();
+    }
+}
+
+namespace ecss
+{
+    static void iter_sparse_select(benchmark::State& state) { ecssSparse<false, EcssPath::View>(state); }
+    static void iter_sparse_select_prefetch(benchmark::State& state) { ecssSparse<false, EcssPath::Prefetch>(state); }
+}
+
+namespace ecss_ts
+{
+    static void iter_sparse_select(benchmark::State& state) { ecssSparse<true, EcssPath::View>(state); }
+}
+
+namespace entt
+{
+    static void iter_sparse_select(benchmark::State& state) { enttSparse(state); }
+}
+
+namespace flecs
+{
+    static void iter_sparse_select(benchmark::State& state) { flecsSparse(state); }
+}
+
+// <ecs>.....................<func>/<entities>/permille:<p>/cluster:<c>
+#define BENCH_SPARSE_ONE(ECS, FUNC) \
+    BENCHMARK(memtrack::tracked<ECS::FUNC>)->Name(TO_FUNC_NAME(FUNC, ECS))->Unit(benchmark::TimeUnit::kMicrosecond) \
+        ->ArgsProduct({{1000000}, {1, 10, 20, 100, 500}, {1, 16, 256}})->ArgNames({"", "permille", "cluster"})->MinTime(0.3);
+
+BENCH_SPARSE_ONE(ecss, iter_sparse_select)
+BENCH_SPARSE_ONE(ecss, iter_sparse_select_prefetch)
+#ifndef _MSC_VER
+BENCH_SPARSE_ONE(ecss_ts, iter_sparse_select)
+#endif
+BENCH_SPARSE_ONE(entt, iter_sparse_select)
+BENCH_SPARSE_ONE(flecs, iter_sparse_select)
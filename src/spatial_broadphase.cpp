@@ -0,0 +1,310 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "components.h"
+#include "registration.h"
+
+// Broadphase over a uniform grid kept in sync with the AABBs: range(0) bodies scattered over a square
+// (about two neighbours in reach each), every frame 5% of them move, the backend's change hook refreshes
+// their grid cell, then all overlapping pairs are counted.
+//  sync_us          - move + index update part of the frame (the ECS integration cost)
+//  pairs            - overlapping pairs found per frame
+//  pairs_per_second - pair-finding throughput
+// items_per_second counts bodies. EnTT keeps the grid in sync through on_construct/on_update/on_destroy,
+// flecs through OnSet/OnRemove observers. ECSS has no hooks: its rows update the grid next to the write.
+namespace {
+    constexpr uint32_t kBroadphaseSeed = 0xB40AD;
+    constexpr float kHalfExtent = 1.f;
+    constexpr float kCellSize = 2.f * kHalfExtent;
+    constexpr float kSpacing = 3.f;   // world side = sqrt(n) * kSpacing
+    constexpr int kMovedPct = 5;
+
+    float worldSize(int64_t n) {
+        return std::max(kCellSize, std::sqrt(static_cast<float>(n)) * kSpacing);
+    }
+
+    AABB boundsOf(const Transform& t) {
+        return AABB{ t.x - kHalfExtent, t.y - kHalfExtent, t.z - kHalfExtent, t.x + kHalfExtent, t.y + kHalfExtent, t.z + kHalfExtent };
+    }
+
+    std::vector<Transform> scatterBodies(int64_t n) {
+        std::mt19937 rng(kBroadphaseSeed);
+        std::uniform_real_distribution<float> coord(kHalfExtent, worldSize(n) - kHalfExtent);
+        std::vector<Transform> bodies(static_cast<size_t>(n));
+        for (auto& t : bodies) {
+            t = Transform{ coord(rng), coord(rng), 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f };
+        }
+        return bodies;
+    }
+
+    // Small deterministic step per (body, frame), kept inside the world. `body` is the spawn index, the
+    // same on every backend (flecs ids are offset by its builtin entities), so every backend moves one world.
+    void moveBody(Transform& t, uint32_t body, uint32_t frame, float size) {
+        uint32_t h = body * 0x9E3779B1u ^ frame * 0x85EBCA77u;
+        h ^= h >> 13;
+        const float dx = (float)(h & 0xFF) / 255.f - 0.5f;
+        const float dy = (float)((h >> 8) & 0xFF) / 255.f - 0.5f;
+        t.x = std::clamp(t.x + dx, kHalfExtent, size - kHalfExtent);
+        t.y = std::clamp(t.y + dy, kHalfExtent, size - kHalfExtent);
+    }
+
+    // Uniform grid over the XY plane with one cell per box size. A body is linked into the cell of its
+    // centre, so every overlapping pair sits in the same or in adjacent cells. Keys are entity indices.
+    class SpatialGrid {
+    public:
+        explicit SpatialGrid(float size)
+            : mDim(std::max<uint32_t>(1, static_cast<uint32_t>(std::ceil(size / kCellSize))))
+            , mHeads(static_cast<size_t>(mDim) * mDim, kNone) {}
+
+        // Insert or move
+        void place(uint32_t key, const AABB& box) {
+            if (key >= mProxies.size()) {
+                mProxies.resize(key + 1);
+            }
+            auto& p = mProxies[key];
+            p.box = box;
+            const uint32_t cell = cellOf(box);
+            if (cell != p.cell) {
+                if (p.cell != kNone) {
+                    unlink(key);
+                }
+                p.cell = cell;
+                link(key);
+            }
+        }
+
+        void remove(uint32_t key) {
+            if (key < mProxies.size() && mProxies[key].cell != kNone) {
+                unlink(key);
+                mProxies[key].cell = kNone;
+            }
+        }
+
+        // Each pair once: the body's own cell after it, plus the forward half of the neighbourhood
+        size_t countPairs() const {
+            static constexpr int kForward[4][2] = { { 1, 0 }, { -1, 1 }, { 0, 1 }, { 1, 1 } };
+            size_t pairs = 0;
+            for (uint32_t cy = 0; cy < mDim; ++cy) {
+                for (uint32_t cx = 0; cx < mDim; ++cx) {
+                    for (uint32_t a = mHeads[cy * mDim + cx]; a != kNone; a = mProxies[a].next) {
+                        const AABB& box = mProxies[a].box;
+                        for (uint32_t b = mProxies[a].next; b != kNone; b = mProxies[b].next) {
+                            pairs += overlaps(box, mProxies[b].box);
+                        }
+                        for (const auto& [ox, oy] : kForward) {
+                            const int64_t nx = static_cast<int64_t>(cx) + ox;
+                            const int64_t ny = static_cast<int64_t>(cy) + oy;
+                            if (nx < 0 || ny < 0 || nx >= mDim || ny >= mDim) {
+                                continue;
+                            }
+                            for (uint32_t b = mHeads[ny * mDim + nx]; b != kNone; b = mProxies[b].next) {
+                                pairs += overlaps(box, mProxies[b].box);
+                            }
+                        }
+                    }
+                }
+            }
+            return pairs;
+        }
+
+    private:
+        static constexpr uint32_t kNone = UINT32_MAX;
+
+        struct Proxy {
+            AABB box{};
+            uint32_t cell = kNone;
+            uint32_t prev = kNone;
+            uint32_t next = kNone;
+        };
+
+        static bool overlaps(const AABB& a, const AABB& b) {
+            return a.minX <= b.maxX && b.minX <= a.maxX
+                && a.minY <= b.maxY && b.minY <= a.maxY
+                && a.minZ <= b.maxZ && b.minZ <= a.maxZ;
+        }
+
+        uint32_t axisCell(float lo, float hi) const {
+            const float centre = (lo + hi) * 0.5f;
+            return std::min(mDim - 1, static_cast<uint32_t>(std::max(0.f, centre / kCellSize)));
+        }
+
+        uint32_t cellOf(const AABB& box) const {
+            return axisCell(box.minY, box.maxY) * mDim + axisCell(box.minX, box.maxX);
+        }
+
+        void link(uint32_t key) {
+            auto& p = mProxies[key];
+            p.prev = kNone;
+            p.next = mHeads[p.cell];
+            if (p.next != kNone) {
+                mProxies[p.next].prev = key;
+            }
+            mHeads[p.cell] = key;
+        }
+
+        void unlink(uint32_t key) {
+            auto& p = mProxies[key];
+            if (p.prev != kNone) {
+                mProxies[p.prev].next = p.next;
+            } else {
+                mHeads[p.cell] = p.next;
+            }
+            if (p.next != kNone) {
+                mProxies[p.next].prev = p.prev;
+            }
+        }
+
+        uint32_t mDim;
+        std::vector<uint32_t> mHeads;
+        std::vector<Proxy> mProxies;
+    };
+
+    // Frame loop shared by the backends: moveSlice(first, count, frame) moves bodies [first, first + count)
+    // of the spawn order and syncs the grid, then the pairs are counted
+    template <typename MoveSlice>
+    void runBroadphase(benchmark::State& state, SpatialGrid& grid, MoveSlice&& moveSlice) {
+        using Clock = std::chrono::steady_clock;
+        const size_t n = static_cast<size_t>(state.range(0));
+        const size_t moved = std::max<size_t>(1, n * kMovedPct / 100);
+        uint32_t frame = 0;
+        double syncNs = 0.0;
+        double pairs = 0.0;
+        size_t lastPairs = 0;
+        for (auto _ : state) {
+            ++frame;
+            const auto start = Clock::now();
+            moveSlice(static_cast<size_t>(frame) * moved % n, moved, frame);
+            syncNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+            lastPairs = grid.countPairs();
+            pairs += static_cast<double>(lastPairs);
+            benchmark::DoNotOptimize(lastPairs);
+        }
+        const double frames = static_cast<double>(std::max<benchmark::IterationCount>(1, state.iterations()));
+        state.counters["sync_us"] = syncNs / frames / 1000.0;
+        state.counters["pairs"] = static_cast<double>(lastPairs);
+        state.counters["pairs_per_second"] = benchmark::Counter(pairs, benchmark::Counter::kIsRate);
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+namespace realistic {
+namespace ecss_r {
+    using Reg = ecss::Registry<false>;
+    using ecss::EntityId;
+
+    static void spatial_broadphase(benchmark::State& state) {
+        const float size = worldSize(state.range(0));
+        SpatialGrid grid(size);
+        Reg reg;
+        reg.registerArray<Transform, AABB>();
+        std::vector<EntityId> ids;
+        for (const auto& t : scatterBodies(state.range(0))) {
+            auto e = reg.takeEntity();
+            reg.addComponent<Transform>(e, t);
+            reg.addComponent<AABB>(e, boundsOf(t));
+            grid.place(static_cast<uint32_t>(e), boundsOf(t));
+            ids.push_back(e);
+        }
+
+        runBroadphase(state, grid, [&](size_t first, size_t count, uint32_t frame) {
+            for (size_t k = 0; k < count; ++k) {
+                const size_t body = (first + k) % ids.size();
+                const auto e = ids[body];
+                auto& t = *reg.getComponent<Transform>(e);
+                moveBody(t, static_cast<uint32_t>(body), frame, size);
+                auto& box = *reg.getComponent<AABB>(e);
+                box = boundsOf(t);
+                grid.place(static_cast<uint32_t>(e), box);
+            }
+        });
+    }
+} // namespace ecss_r
+
+namespace entt_r {
+    static void placeBody(SpatialGrid& grid, entt::registry& reg, entt::entity e) {
+        grid.place(static_cast<uint32_t>(entt::to_entity(e)), reg.get<AABB>(e));
+    }
+
+    static void removeBody(SpatialGrid& grid, entt::registry&, entt::entity e) {
+        grid.remove(static_cast<uint32_t>(entt::to_entity(e)));
+    }
+
+    static void spatial_broadphase(benchmark::State& state) {
+        const float size = worldSize(state.range(0));
+        SpatialGrid grid(size);
+        entt::registry reg;
+        reg.on_construct<AABB>().connect<&placeBody>(grid);
+        reg.on_update<AABB>().connect<&placeBody>(grid);
+        reg.on_destroy<AABB>().connect<&removeBody>(grid);
+
+        std::vector<entt::entity> ids;
+        for (const auto& t : scatterBodies(state.range(0))) {
+            auto e = reg.create();
+            reg.emplace<Transform>(e, t);
+            reg.emplace<AABB>(e, boundsOf(t));
+            ids.push_back(e);
+        }
+
+        auto& transforms = reg.storage<Transform>();
+        runBroadphase(state, grid, [&](size_t first, size_t count, uint32_t frame) {
+            for (size_t k = 0; k < count; ++k) {
+                const size_t body = (first + k) % ids.size();
+                const auto e = ids[body];
+                auto& t = transforms.get(e);
+                moveBody(t, static_cast<uint32_t>(body), frame, size);
+                reg.replace<AABB>(e, boundsOf(t));
+            }
+        });
+    }
+} // namespace entt_r
+
+namespace flecs_r {
+    static void spatial_broadphase(benchmark::State& state) {
+        const float size = worldSize(state.range(0));
+        SpatialGrid grid(size);
+        flecs::world world;
+        world.component<Transform>();
+        world.component<AABB>();
+        world.observer<const AABB>().event(flecs::OnSet).each([&grid](flecs::entity e, const AABB& box) {
+            grid.place(static_cast<uint32_t>(e.id()), box);
+        });
+        world.observer<const AABB>().event(flecs::OnRemove).each([&grid](flecs::entity e, const AABB&) {
+            grid.remove(static_cast<uint32_t>(e.id()));
+        });
+
+        std::vector<flecs::entity> ids;
+        for (const auto& t : scatterBodies(state.range(0))) {
+            ids.push_back(world.entity().set<Transform>(t).set<AABB>(boundsOf(t)));
+        }
+
+        runBroadphase(state, grid, [&](size_t first, size_t count, uint32_t frame) {
+            for (size_t k = 0; k < count; ++k) {
+                const size_t body = (first + k) % ids.size();
+                auto e = ids[body];
+                auto* t = e.try_get_mut<Transform>();
+                moveBody(*t, static_cast<uint32_t>(body), frame, size);
+                e.set<AABB>(boundsOf(*t));
+            }
+        });
+    }
+} // namespace flecs_r
+} // namespace realistic
+
+// realistic/<ecs>/spatial_broadphase/<bodies>
+#define BENCH_BROADPHASE_ONE(ECS) \
+    BENCHMARK(memtrack::tracked<realistic::ECS::spatial_broadphase>)->Name("realistic/" #ECS "/spatial_broadphase") \
+        ->Unit(benchmark::TimeUnit::kMicrosecond)->Arg(10000)->Arg(100000)->Arg(1000000)->MinTime(0.3);
+
+BENCH_BROADPHASE_ONE(ecss_r)
+BENCH_BROADPHASE_ONE(entt_r)
+BENCH_BROADPHASE_ONE(flecs_r)
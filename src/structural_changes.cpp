@@ -0,0 +1,249 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "command_buffer.h"
+#include "components.h"
+#include "registration.h"
+
+// Structural-change throughput: every frame (range(1) = churn %, k = n * churn / 100)
+//  - k entities are destroyed and replaced by fresh Position+Velocity entities
+//  - k other entities toggle Health (added if missing, removed otherwise)
+// The two windows walk the population like a ring and never overlap (churn <= 50%).
+// Deferred variants record everything first and replay it at one sync point, the way a system
+// running inside a query would; *_immediate variants apply each change on the spot.
+// items_per_second = structural changes (destroy + spawn + toggle, 3k per frame).
+namespace {
+    struct ChurnRing {
+        int n = 0;
+        int k = 0;
+        int cursor = 0;
+
+        explicit ChurnRing(const benchmark::State& state)
+            : n(static_cast<int>(state.range(0))), k(static_cast<int>(state.range(0) * state.range(1) / 100)) {}
+
+        int respawnSlot(int j) const { return (cursor + j) % n; }
+        int toggleSlot(int j) const { return (cursor + n / 2 + j) % n; }
+        void advance() { cursor = (cursor + k) % n; }
+    };
+
+    void reportChanges(benchmark::State& state, const ChurnRing& ring) {
+        state.SetItemsProcessed(state.iterations() * 3 * static_cast<int64_t>(ring.k));
+        state.counters["changes_per_frame"] = 3.0 * ring.k;
+    }
+
+    constexpr Health kFreshHealth{ 100.f, 100.f, 1.f, false };
+}
+
+namespace realistic {
+namespace ecss_r {
+    using Reg = ecss::Registry<false>;
+
+    // Deferred: cmd::CommandBuffer replayed once per frame (sorted per type, one destroyEntities call)
+    template <bool Deferred>
+    static void structural_churn(benchmark::State& state) {
+        Reg reg;
+        reg.registerArray<Position, Velocity>();
+        ChurnRing ring(state);
+
+        std::vector<ecss::EntityId> slots(ring.n);
+        std::vector<uint8_t> hasHealth(ring.n, 0);
+        for (int i = 0; i < ring.n; ++i) {
+            slots[i] = reg.takeEntity();
+            reg.addComponent<Position>(slots[i], Position{ (float)i, 0.f, 0.f });
+            reg.addComponent<Velocity>(slots[i], Velocity{ 1.f, 0.f, 0.f });
+        }
+
+        cmd::CommandBuffer<false> buffer;
+        std::vector<ecss::EntityId> single(1);
+        int frameCounter = 0;
+        for (auto _ : state) {
+            if constexpr (Deferred) {
+                for (int j = 0; j < ring.k; ++j) {
+                    const int s = ring.respawnSlot(j);
+                    buffer.destroy(slots[s]);
+                    // ids are handed out immediately; destroyed ids are only recycled on apply()
+                    slots[s] = reg.takeEntity();
+                    buffer.add<Position>(slots[s], Position{ (float)frameCounter, (float)j, 0.f });
+                    buffer.add<Velocity>(slots[s], Velocity{ 1.f, 0.f, 0.f });
+                    hasHealth[s] = 0;
+                }
+                for (int j = 0; j < ring.k; ++j) {
+                    const int s = ring.toggleSlot(j);
+                    if (hasHealth[s]) {
+                        buffer.remove<Health>(slots[s]);
+                    } else {
+                        buffer.add<Health>(slots[s], kFreshHealth);
+                    }
+                    hasHealth[s] ^= 1;
+                }
+                buffer.apply(reg);
+            } else {
+                for (int j = 0; j < ring.k; ++j) {
+                    const int s = ring.respawnSlot(j);
+                    single[0] = slots[s];
+                    reg.destroyEntities(single);
+                    slots[s] = reg.takeEntity();
+                    reg.addComponent<Position>(slots[s], Position{ (float)frameCounter, (float)j, 0.f });
+                    reg.addComponent<Velocity>(slots[s], Velocity{ 1.f, 0.f, 0.f });
+                    hasHealth[s] = 0;
+                }
+                for (int j = 0; j < ring.k; ++j) {
+                    const int s = ring.toggleSlot(j);
+                    if (hasHealth[s]) {
+                        reg.destroyComponent<Health>(slots[s]);
+                    } else {
+                        reg.addComponent<Health>(slots[s], kFreshHealth);
+                    }
+                    hasHealth[s] ^= 1;
+                }
+            }
+            ring.advance();
+            frameCounter++;
+            benchmark::ClobberMemory();
+        }
+        reportChanges(state, ring);
+    }
+} // namespace ecss_r
+
+namespace entt_r {
+    // Deferred: changes collected into id lists, then applied with the range overloads
+    // (destroy(first, last), create(first, last), insert, remove(first, last))
+    template <bool Deferred>
+    static void structural_churn(benchmark::State& state) {
+        entt::registry reg;
+        ChurnRing ring(state);
+
+        std::vector<entt::entity> slots(ring.n);
+        std::vector<uint8_t> hasHealth(ring.n, 0);
+        reg.create(slots.begin(), slots.end());
+        for (int i = 0; i < ring.n; ++i) {
+            reg.emplace<Position>(slots[i], Position{ (float)i, 0.f, 0.f });
+            reg.emplace<Velocity>(slots[i], Velocity{ 1.f, 0.f, 0.f });
+        }
+
+        std::vector<entt::entity> toDestroy, spawned, toAdd, toRemove;
+        std::vector<int> spawnSlots;
+        int frameCounter = 0;
+        for (auto _ : state) {
+            if constexpr (Deferred) {
+                toDestroy.clear(); spawnSlots.clear(); toAdd.clear(); toRemove.clear();
+                for (int j = 0; j < ring.k; ++j) {
+                    const int s = ring.respawnSlot(j);
+                    toDestroy.push_back(slots[s]);
+                    spawnSlots.push_back(s);
+                    hasHealth[s] = 0;
+                }
+                for (int j = 0; j < ring.k; ++j) {
+                    const int s = ring.toggleSlot(j);
+                    (hasHealth[s] ? toRemove : toAdd).push_back(slots[s]);
+                    hasHealth[s] ^= 1;
+                }
+
+                // sync point
+                reg.destroy(toDestroy.begin(), toDestroy.end());
+                spawned.resize(spawnSlots.size());
+                reg.create(spawned.begin(), spawned.end());
+                reg.insert<Position>(spawned.begin(), spawned.end(), Position{ (float)frameCounter, 0.f, 0.f });
+                reg.insert<Velocity>(spawned.begin(), spawned.end(), Velocity{ 1.f, 0.f, 0.f });
+                for (size_t j = 0; j < spawned.size(); ++j) {
+                    slots[spawnSlots[j]] = spawned[j];
+                }
+                reg.insert<Health>(toAdd.begin(), toAdd.end(), kFreshHealth);
+                reg.remove<Health>(toRemove.begin(), toRemove.end());
+            } else {
+                for (int j = 0; j < ring.k; ++j) {
+                    const int s = ring.respawnSlot(j);
+                    reg.destroy(slots[s]);
+                    slots[s] = reg.create();
+                    reg.emplace<Position>(slots[s], Position{ (float)frameCounter, (float)j, 0.f });
+                    reg.emplace<Velocity>(slots[s], Velocity{ 1.f, 0.f, 0.f });
+                    hasHealth[s] = 0;
+                }
+                for (int j = 0; j < ring.k; ++j) {
+                    const int s = ring.toggleSlot(j);
+                    if (hasHealth[s]) {
+                        reg.remove<Health>(slots[s]);
+                    } else {
+                        reg.emplace<Health>(slots[s], kFreshHealth);
+                    }
+                    hasHealth[s] ^= 1;
+                }
+            }
+            ring.advance();
+            frameCounter++;
+            benchmark::ClobberMemory();
+        }
+        reportChanges(state, ring);
+    }
+} // namespace entt_r
+
+namespace flecs_r {
+    // Deferred: the same calls between defer_begin()/defer_end(), flecs queues and merges them
+    template <bool Deferred>
+    static void structural_churn(benchmark::State& state) {
+        flecs::world world;
+        world.component<Position>();
+        world.component<Velocity>();
+        world.component<Health>();
+        ChurnRing ring(state);
+
+        std::vector<flecs::entity> slots;
+        std::vector<uint8_t> hasHealth(ring.n, 0);
+        slots.reserve(ring.n);
+        for (int i = 0; i < ring.n; ++i) {
+            slots.push_back(world.entity()
+                .set<Position>({ (float)i, 0.f, 0.f })
+                .set<Velocity>({ 1.f, 0.f, 0.f }));
+        }
+
+        int frameCounter = 0;
+        for (auto _ : state) {
+            if constexpr (Deferred) {
+                world.defer_begin();
+            }
+            for (int j = 0; j < ring.k; ++j) {
+                const int s = ring.respawnSlot(j);
+                slots[s].destruct();
+                slots[s] = world.entity()
+                    .set<Position>({ (float)frameCounter, (float)j, 0.f })
+                    .set<Velocity>({ 1.f, 0.f, 0.f });
+                hasHealth[s] = 0;
+            }
+            for (int j = 0; j < ring.k; ++j) {
+                const int s = ring.toggleSlot(j);
+                if (hasHealth[s]) {
+                    slots[s].remove<Health>();
+                } else {
+                    slots[s].set<Health>(kFreshHealth);
+                }
+                hasHealth[s] ^= 1;
+            }
+            if constexpr (Deferred) {
+                world.defer_end();
+            }
+            ring.advance();
+            frameCounter++;
+            benchmark::ClobberMemory();
+        }
+        reportChanges(state, ring);
+    }
+} // namespace flecs_r
+} // namespace realistic
+
+// realistic/<ecs>/structural_churn[_immediate]/<entities>/churn_pct:<pct>
+#define BENCH_STRUCTURAL_ONE(ECS, NAME, DEFERRED) \
+    BENCHMARK(memtrack::tracked<realistic::ECS::structural_churn<DEFERRED>>)->Name("realistic/" #ECS "/" NAME) \
+        ->Unit(benchmark::TimeUnit::kMicrosecond)->ArgsProduct({{100000, 1000000}, {10, 50}})->ArgNames({"", "churn_pct"})->MinTime(0.3);
+
+#define REGISTER_STRUCTURAL(ECS) \
+    BENCH_STRUCTURAL_ONE(ECS, "structural_churn", true) \
+    BENCH_STRUCTURAL_ONE(ECS, "structural_churn_immediate", false)
+
+REGISTER_STRUCTURAL(ecss_r)
+REGISTER_STRUCTURAL(entt_r)
+REGISTER_STRUCTURAL(flecs_r)
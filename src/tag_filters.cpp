@@ -0,0 +1,240 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "components.h"
+#include "registration.h"
+
+// Culling with zero-size tags: range(0) Transform + RigidBody bodies, physics integration over the
+// range(1) percent that pass the filter. Tagged entities are scattered (hash of the index).
+//  tag_include - only bodies with Tag_Enemy (range(1)% of them carry it)
+//  tag_exclude - bodies without Tag_Static (the other 100 - range(1)% carry it)
+//  tag_bytes_per_entity - heap growth from adding the tags, per tagged entity (memory tracking builds)
+// ECSS has neither empty-type storage nor exclusion filters: tags are 1-byte components, includes are a
+// third view type, excludes probe getComponent<Tag_Static> per id.
+namespace {
+    constexpr float kDt = 1.f / 60.f;
+
+    bool hasTag(int i, int64_t pct) {
+        uint32_t h = static_cast<uint32_t>(i) * 0x9E3779B1u;
+        h ^= h >> 16;
+        return static_cast<int64_t>(h % 100) < pct;
+    }
+
+    Transform bodyTransform(int i) {
+        return Transform{ (float)i, (float)(i * 2), 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f };
+    }
+
+    RigidBody fallingBody() {
+        return RigidBody{ 1.f, 0.5f, 0.f, 0.f, -9.8f, 0.f, 1.f, 0.1f };
+    }
+
+    void integrate(Transform& t, RigidBody& rb) {
+        rb.vx += rb.ax * kDt;
+        rb.vy += rb.ay * kDt;
+        rb.vz += rb.az * kDt;
+        rb.vx *= (1.f - rb.drag * kDt);
+        rb.vy *= (1.f - rb.drag * kDt);
+        rb.vz *= (1.f - rb.drag * kDt);
+        t.x += rb.vx * kDt;
+        t.y += rb.vy * kDt;
+        t.z += rb.vz * kDt;
+    }
+
+    // Share of entities carrying the tag: the selected ones for includes, the rejected ones for excludes
+    int64_t taggedPct(const benchmark::State& state, bool include) {
+        return include ? state.range(1) : 100 - state.range(1);
+    }
+
+    // Runs tagAll() and reports its heap growth per tagged entity
+    template <typename Fn>
+    void tagAndMeasure(benchmark::State& state, Fn&& tagAll) {
+#if ECSS_BENCH_MEMORY_TRACKING
+        const auto before = memtrack::snapshot();
+        const size_t tagged = tagAll();
+        const auto after = memtrack::snapshot();
+        state.counters["tag_bytes_per_entity"] = tagged ? static_cast<double>(after.liveBytes - before.liveBytes) / static_cast<double>(tagged) : 0.0;
+#else
+        (void)state;
+        tagAll();
+#endif
+    }
+
+    void reportSelected(benchmark::State& state) {
+        state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1) / 100);
+    }
+}
+
+namespace realistic {
+namespace ecss_r {
+    using Reg = ecss::Registry<false>;
+    using ecss::EntityId;
+
+    template <typename Tag>
+    static void spawnTagged(benchmark::State& state, Reg& reg, std::vector<EntityId>& ids, int64_t pct) {
+        reg.registerArray<Transform, RigidBody>();
+        const int n = state.range(0);
+        ids.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            auto e = reg.takeEntity();
+            reg.addComponent<Transform>(e, bodyTransform(i));
+            reg.addComponent<RigidBody>(e, fallingBody());
+            ids.push_back(e);
+        }
+        tagAndMeasure(state, [&] {
+            size_t tagged = 0;
+            for (int i = 0; i < n; ++i) {
+                if (hasTag(i, pct)) {
+                    reg.addComponent<Tag>(ids[i], Tag{});
+                    ++tagged;
+                }
+            }
+            return tagged;
+        });
+    }
+
+    static void tag_include(benchmark::State& state) {
+        Reg reg;
+        std::vector<EntityId> ids;
+        spawnTagged<Tag_Enemy>(state, reg, ids, taggedPct(state, true));
+
+        auto view = reg.view<Transform, RigidBody, Tag_Enemy>();
+        for (auto _ : state) {
+            view.each([](Transform& t, RigidBody& rb, Tag_Enemy&) { integrate(t, rb); });
+            benchmark::ClobberMemory();
+        }
+        reportSelected(state);
+    }
+
+    static void tag_exclude(benchmark::State& state) {
+        Reg reg;
+        std::vector<EntityId> ids;
+        spawnTagged<Tag_Static>(state, reg, ids, taggedPct(state, false));
+
+        for (auto _ : state) {
+            for (auto e : ids) {
+                if (reg.getComponent<Tag_Static>(e) == nullptr) {
+                    integrate(*reg.getComponent<Transform>(e), *reg.getComponent<RigidBody>(e));
+                }
+            }
+            benchmark::ClobberMemory();
+        }
+        reportSelected(state);
+    }
+} // namespace ecss_r
+
+namespace entt_r {
+    // Empty types get a storage without payload (entities only) and are skipped in each()
+    template <typename Tag>
+    static void spawnTagged(benchmark::State& state, entt::registry& reg, int64_t pct) {
+        const int n = state.range(0);
+        std::vector<entt::entity> ids(n);
+        reg.create(ids.begin(), ids.end());
+        for (int i = 0; i < n; ++i) {
+            reg.emplace<Transform>(ids[i], bodyTransform(i));
+            reg.emplace<RigidBody>(ids[i], fallingBody());
+        }
+        tagAndMeasure(state, [&] {
+            size_t tagged = 0;
+            for (int i = 0; i < n; ++i) {
+                if (hasTag(i, pct)) {
+                    reg.emplace<Tag>(ids[i]);
+                    ++tagged;
+                }
+            }
+            return tagged;
+        });
+    }
+
+    static void tag_include(benchmark::State& state) {
+        entt::registry reg;
+        spawnTagged<Tag_Enemy>(state, reg, taggedPct(state, true));
+
+        auto view = reg.view<Transform, RigidBody, Tag_Enemy>();
+        for (auto _ : state) {
+            view.each([](Transform& t, RigidBody& rb) { integrate(t, rb); });
+            benchmark::ClobberMemory();
+        }
+        reportSelected(state);
+    }
+
+    static void tag_exclude(benchmark::State& state) {
+        entt::registry reg;
+        spawnTagged<Tag_Static>(state, reg, taggedPct(state, false));
+
+        auto view = reg.view<Transform, RigidBody>(entt::exclude<Tag_Static>);
+        for (auto _ : state) {
+            view.each([](Transform& t, RigidBody& rb) { integrate(t, rb); });
+            benchmark::ClobberMemory();
+        }
+        reportSelected(state);
+    }
+} // namespace entt_r
+
+namespace flecs_r {
+    // Tags are ids in the table type: tagged entities live in their own table, with no column
+    template <typename Tag>
+    static void spawnTagged(benchmark::State& state, flecs::world& world, int64_t pct) {
+        world.component<Transform>();
+        world.component<RigidBody>();
+        world.component<Tag>();
+        const int n = state.range(0);
+        std::vector<flecs::entity> ids;
+        ids.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            ids.push_back(world.entity().set<Transform>(bodyTransform(i)).set<RigidBody>(fallingBody()));
+        }
+        tagAndMeasure(state, [&] {
+            size_t tagged = 0;
+            for (int i = 0; i < n; ++i) {
+                if (hasTag(i, pct)) {
+                    ids[i].add<Tag>();
+                    ++tagged;
+                }
+            }
+            return tagged;
+        });
+    }
+
+    static void tag_include(benchmark::State& state) {
+        flecs::world world;
+        spawnTagged<Tag_Enemy>(state, world, taggedPct(state, true));
+
+        auto q = world.query_builder<Transform, RigidBody>().with<Tag_Enemy>().build();
+        for (auto _ : state) {
+            q.each([](Transform& t, RigidBody& rb) { integrate(t, rb); });
+            benchmark::ClobberMemory();
+        }
+        reportSelected(state);
+    }
+
+    static void tag_exclude(benchmark::State& state) {
+        flecs::world world;
+        spawnTagged<Tag_Static>(state, world, taggedPct(state, false));
+
+        auto q = world.query_builder<Transform, RigidBody>().without<Tag_Static>().build();
+        for (auto _ : state) {
+            q.each([](Transform& t, RigidBody& rb) { integrate(t, rb); });
+            benchmark::ClobberMemory();
+        }
+        reportSelected(state);
+    }
+} // namespace flecs_r
+} // namespace realistic
+
+// realistic/<ecs>/tag_include|tag_exclude/<entities>/selected_pct:<1|50|99>
+#define BENCH_TAG_FILTER_ONE(ECS, FUNC) \
+    BENCHMARK(memtrack::tracked<realistic::ECS::FUNC>)->Name("realistic/" #ECS "/" #FUNC) \
+        ->Unit(benchmark::TimeUnit::kMicrosecond)->ArgsProduct({{100000, 1000000}, {1, 50, 99}})->ArgNames({"", "selected_pct"})->MinTime(0.3);
+
+#define REGISTER_TAG_FILTER(FUNC) \
+    BENCH_TAG_FILTER_ONE(ecss_r, FUNC) \
+    BENCH_TAG_FILTER_ONE(entt_r, FUNC) \
+    BENCH_TAG_FILTER_ONE(flecs_r, FUNC)
+
+REGISTER_TAG_FILTER(tag_include)
+REGISTER_TAG_FILTER(tag_exclude)
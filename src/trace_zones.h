@@ -0,0 +1,228 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <utility>
+
+#ifndef ECSS_BENCH_TRACING
+#define ECSS_BENCH_TRACING 0
+#endif
+
+// Scoped zones around the systems and phases of the realistic scenarios.
+//     { TRACE_ZONE("physics"); ... }                                            // times the enclosing block
+//     auto view = trace::timed("physics_view", [&] { return reg.view<...>(); }); // times one expression
+// Rows run through trace::zoned<F> report zone_<name>_us, the time per iteration spent in each zone
+// (nested zones count towards their parent as well). With ECSS_BENCH_TRACE=<file> in the environment every
+// zone is also kept as a Chrome trace event (chrome://tracing, Perfetto; Tracy loads it through
+// tracy-import-chrome) under one event per benchmark run, and the file is written at exit. The first
+// kMaxEvents events are kept, later ones only counted. Single-threaded, like the realistic scenarios.
+// Compiled in with ECSS_BENCH_TRACING; otherwise TRACE_ZONE is a no-op, timed() just calls the function
+// and zoned<F> runs F.
+#if ECSS_BENCH_TRACING
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace trace {
+    using Clock = std::chrono::steady_clock;
+
+    class Recorder {
+    public:
+        static constexpr size_t kMaxEvents = size_t(1) << 20;
+        static constexpr size_t kMaxZones = 64;
+        static constexpr uint32_t kNoRun = ~uint32_t{ 0 };
+
+        struct Zone {
+            const char* name = nullptr; // string literal, compared by address first
+            int64_t ns = 0;
+            uint64_t calls = 0;
+        };
+
+        static Recorder& instance() {
+            static Recorder recorder;
+            return recorder;
+        }
+
+        void record(const char* name, Clock::time_point begin, Clock::time_point end) {
+            if (Zone* zone = zoneOf(name)) {
+                zone->ns += std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+                ++zone->calls;
+            }
+            push(name, begin, end);
+        }
+
+        // Zone totals restart with every run, so they describe the run they are attached to
+        void beginRun(std::string name) {
+            mZoneCount = 0;
+            mRunBegin = Clock::now();
+            if (!mPath.empty()) {
+                mRun = static_cast<uint32_t>(mRuns.size());
+                mRuns.push_back(std::move(name));
+            }
+        }
+
+        void endRun() {
+            push(nullptr, mRunBegin, Clock::now());
+            mRun = kNoRun;
+        }
+
+        const Zone* begin() const { return mZones.data(); }
+        const Zone* end() const { return mZones.data() + mZoneCount; }
+
+        Recorder(const Recorder&) = delete;
+        Recorder& operator=(const Recorder&) = delete;
+
+    private:
+        struct Event {
+            const char* name; // nullptr = the run itself
+            uint32_t run;
+            int64_t beginNs;
+            int64_t durationNs;
+        };
+
+        Recorder() : mEpoch(Clock::now()) {
+            if (const char* path = std::getenv("ECSS_BENCH_TRACE"); path && *path) {
+                mPath = path;
+                mEvents.reserve(kMaxEvents);
+            }
+        }
+
+        ~Recorder() {
+            if (!mPath.empty()) {
+                write();
+            }
+        }
+
+        Zone* zoneOf(const char* name) {
+            for (size_t i = 0; i < mZoneCount; ++i) {
+                if (mZones[i].name == name || std::strcmp(mZones[i].name, name) == 0) {
+                    return &mZones[i];
+                }
+            }
+            if (mZoneCount == kMaxZones) {
+                return nullptr;
+            }
+            mZones[mZoneCount] = Zone{ name };
+            return &mZones[mZoneCount++];
+        }
+
+        void push(const char* name, Clock::time_point begin, Clock::time_point end) {
+            if (mPath.empty() || mRun == kNoRun) {
+                return;
+            }
+            if (mEvents.size() == kMaxEvents) {
+                ++mDropped;
+                return;
+            }
+            mEvents.push_back(Event{ name, mRun,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(begin - mEpoch).count(),
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() });
+        }
+
+        static void writeString(std::FILE* file, const char* text) {
+            std::fputc('"', file);
+            for (; *text; ++text) {
+                if (*text == '"' || *text == '\\') {
+                    std::fputc('\\', file);
+                }
+                std::fputc(*text, file);
+            }
+            std::fputc('"', file);
+        }
+
+        // JSON object format, complete ("X") events in microseconds
+        void write() const {
+            std::FILE* file = std::fopen(mPath.c_str(), "w");
+            if (!file) {
+                std::fprintf(stderr, "ECSS_BENCH_TRACE: cannot write %s\n", mPath.c_str());
+                return;
+            }
+            std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", file);
+            for (size_t i = 0; i < mEvents.size(); ++i) {
+                const Event& event = mEvents[i];
+                const char* run = mRuns[event.run].c_str();
+                std::fputs("{\"name\":", file);
+                writeString(file, event.name ? event.name : run);
+                std::fputs(",\"cat\":", file);
+                writeString(file, event.name ? run : "run");
+                std::fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}%s\n",
+                    static_cast<double>(event.beginNs) / 1000.0, static_cast<double>(event.durationNs) / 1000.0,
+                    i + 1 < mEvents.size() ? "," : "");
+            }
+            std::fprintf(file, "],\"otherData\":{\"dropped_events\":%llu}}\n", static_cast<unsigned long long>(mDropped));
+            std::fclose(file);
+        }
+
+        const Clock::time_point mEpoch;
+        std::string mPath;
+        std::array<Zone, kMaxZones> mZones{};
+        size_t mZoneCount = 0;
+        std::vector<Event> mEvents;
+        std::vector<std::string> mRuns;
+        uint32_t mRun = kNoRun;
+        Clock::time_point mRunBegin;
+        uint64_t mDropped = 0;
+    };
+
+    // Built before main(), so the event buffer is not allocated inside the first tracked benchmark
+    inline const bool gRecorderReady = (Recorder::instance(), true);
+
+    class Zone {
+    public:
+        explicit Zone(const char* name) : mName(name), mBegin(Clock::now()) {}
+        ~Zone() { Recorder::instance().record(mName, mBegin, Clock::now()); }
+        Zone(const Zone&) = delete;
+        Zone& operator=(const Zone&) = delete;
+
+    private:
+        const char* mName;
+        Clock::time_point mBegin;
+    };
+
+    template <typename Fn>
+    decltype(auto) timed(const char* name, Fn&& fn) {
+        Zone zone(name);
+        return std::forward<Fn>(fn)();
+    }
+
+    template <void (*Func)(benchmark::State&)>
+    void zoned(benchmark::State& state) {
+        Recorder& recorder = Recorder::instance();
+        recorder.beginRun(state.name());
+        Func(state);
+        recorder.endRun();
+
+        const double iterations = state.iterations() > 0 ? static_cast<double>(state.iterations()) : 1.0;
+        for (const auto& zone : recorder) {
+            state.counters[std::string("zone_") + zone.name + "_us"] = static_cast<double>(zone.ns) / 1000.0 / iterations;
+        }
+    }
+}
+
+#define TRACE_ZONE_CONCAT_(a, b) a##b
+#define TRACE_ZONE_CONCAT(a, b) TRACE_ZONE_CONCAT_(a, b)
+#define TRACE_ZONE(name) ::trace::Zone TRACE_ZONE_CONCAT(traceZone_, __LINE__)(name)
+
+#else
+
+namespace trace {
+    template <typename Fn>
+    decltype(auto) timed(const char*, Fn&& fn) {
+        return std::forward<Fn>(fn)();
+    }
+
+    template <void (*Func)(benchmark::State&)>
+    void zoned(benchmark::State& state) {
+        Func(state);
+    }
+}
+
+#define TRACE_ZONE(name) ((void)0)
+
+#endif
@@ -0,0 +1,194 @@
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+#include <flecs.h>
+#include <ecss/Registry.h>
+
+#include <optional>
+
+#include "components.h"
+#include "registration.h"
+
+// Cost of making a view/query for Position + Velocity, as tooling and scripts do for ad-hoc queries.
+// The world holds range(0) Position + Velocity entities and range(1) extra component types
+// (Filler<k>, entity i gets Filler<i % types>), so there are more pools to look up and tables to match.
+//  *_create         - create (and drop) the view/query
+//  *_create_iterate - create, run the first pass over it, drop
+// EnTT groups live as long as the registry, so group rows get a fresh world per iteration (untimed).
+namespace {
+    constexpr size_t kMaxFillerTypes = 100;
+    constexpr float kDt = 1.f / 60.f;
+
+    void step(Position& p, const Velocity& v) {
+        p.x += v.vx * kDt;
+        p.y += v.vy * kDt;
+        p.z += v.vz * kDt;
+    }
+
+    // registerType<Filler<k>>() for each of the range(1) extra types, then spawn(i, types) per entity
+    template <typename Register, typename Spawn>
+    void buildWorld(const benchmark::State& state, Register&& registerType, Spawn&& spawn) {
+        const size_t types = static_cast<size_t>(state.range(1));
+        for (size_t k = 0; k < types; ++k) {
+            withFiller<kMaxFillerTypes>(k, registerType);
+        }
+        const int n = state.range(0);
+        for (int i = 0; i < n; ++i) {
+            spawn(i, types);
+        }
+    }
+}
+
+namespace realistic {
+namespace ecss_r {
+    using Reg = ecss::Registry<false>;
+
+    struct ViewWorld {
+        Reg reg;
+
+        explicit ViewWorld(const benchmark::State& state) {
+            buildWorld(state,
+                [&]<typename T>() { reg.registerArray<T>(); },
+                [&](int i, size_t types) {
+                    auto e = reg.takeEntity();
+                    reg.addComponent<Position>(e, Position{ (float)i, 0.f, 0.f });
+                    reg.addComponent<Velocity>(e, Velocity{ 1.f, 1.f, 0.f });
+                    if (types > 0) {
+                        withFiller<kMaxFillerTypes>(i % types, [&]<typename T>() { reg.addComponent<T>(e, T{ (float)i }); });
+                    }
+                });
+        }
+    };
+
+    template <bool Iterate>
+    static void viewCreate(benchmark::State& state) {
+        ViewWorld world(state);
+        for (auto _ : state) {
+            auto view = world.reg.view<Position, Velocity>();
+            if constexpr (Iterate) {
+                view.each([](Position& p, Velocity& v) { step(p, v); });
+            }
+            benchmark::DoNotOptimize(view);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    static void view_create(benchmark::State& state) { viewCreate<false>(state); }
+    static void view_create_iterate(benchmark::State& state) { viewCreate<true>(state); }
+} // namespace ecss_r
+
+namespace entt_r {
+    struct ViewWorld {
+        entt::registry reg;
+
+        explicit ViewWorld(const benchmark::State& state) {
+            buildWorld(state,
+                [&]<typename T>() { reg.storage<T>(); },
+                [&](int i, size_t types) {
+                    auto e = reg.create();
+                    reg.emplace<Position>(e, Position{ (float)i, 0.f, 0.f });
+                    reg.emplace<Velocity>(e, Velocity{ 1.f, 1.f, 0.f });
+                    if (types > 0) {
+                        withFiller<kMaxFillerTypes>(i % types, [&]<typename T>() { reg.emplace<T>(e, T{ (float)i }); });
+                    }
+                });
+        }
+    };
+
+    template <bool Iterate>
+    static void viewCreate(benchmark::State& state) {
+        ViewWorld world(state);
+        for (auto _ : state) {
+            auto view = world.reg.view<Position, const Velocity>();
+            if constexpr (Iterate) {
+                view.each([](Position& p, const Velocity& v) { step(p, v); });
+            }
+            benchmark::DoNotOptimize(view);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // First group<>() on a registry: registers the group and packs both pools
+    template <bool Iterate>
+    static void groupCreate(benchmark::State& state) {
+        std::optional<ViewWorld> world;
+        for (auto _ : state) {
+            state.PauseTiming();
+            world.reset();
+            world.emplace(state);
+            state.ResumeTiming();
+
+            auto group = world->reg.group<Position, Velocity>();
+            if constexpr (Iterate) {
+                group.each([](Position& p, const Velocity& v) { step(p, v); });
+            }
+            benchmark::DoNotOptimize(group);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    static void view_create(benchmark::State& state) { viewCreate<false>(state); }
+    static void view_create_iterate(benchmark::State& state) { viewCreate<true>(state); }
+    static void group_create(benchmark::State& state) { groupCreate<false>(state); }
+    static void group_create_iterate(benchmark::State& state) { groupCreate<true>(state); }
+} // namespace entt_r
+
+namespace flecs_r {
+    struct ViewWorld {
+        flecs::world world;
+
+        explicit ViewWorld(const benchmark::State& state) {
+            world.component<Position>();
+            world.component<Velocity>();
+            buildWorld(state,
+                [&]<typename T>() { world.component<T>(); },
+                [&](int i, size_t types) {
+                    auto e = world.entity().set<Position>({ (float)i, 0.f, 0.f }).set<Velocity>({ 1.f, 1.f, 0.f });
+                    if (types > 0) {
+                        withFiller<kMaxFillerTypes>(i % types, [&]<typename T>() { e.set<T>(T{ (float)i }); });
+                    }
+                });
+        }
+    };
+
+    // Uncached queries match tables while iterating; cached ones match on creation and are then kept
+    // up to date by the world, so both are destructed inside the timed region
+    template <bool Cached, bool Iterate>
+    static void queryCreate(benchmark::State& state) {
+        ViewWorld world(state);
+        for (auto _ : state) {
+            auto builder = world.world.query_builder<Position, const Velocity>();
+            if constexpr (Cached) {
+                builder.cached();
+            }
+            auto q = builder.build();
+            if constexpr (Iterate) {
+                q.each([](Position& p, const Velocity& v) { step(p, v); });
+            }
+            benchmark::DoNotOptimize(q);
+            q.destruct();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    static void query_create(benchmark::State& state) { queryCreate<false, false>(state); }
+    static void query_create_iterate(benchmark::State& state) { queryCreate<false, true>(state); }
+    static void query_cached_create(benchmark::State& state) { queryCreate<true, false>(state); }
+    static void query_cached_create_iterate(benchmark::State& state) { queryCreate<true, true>(state); }
+} // namespace flecs_r
+} // namespace realistic
+
+// realistic/<ecs>/<func>/<entities>/types:<extra component types>; items_per_second = creations
+#define BENCH_VIEW_CREATION_ONE(ECS, FUNC) \
+    BENCHMARK(memtrack::tracked<realistic::ECS::FUNC>)->Name("realistic/" #ECS "/" #FUNC) \
+        ->Unit(benchmark::TimeUnit::kMicrosecond)->ArgsProduct({{0, 10000}, {0, 10, 100}})->ArgNames({"", "types"})->MinTime(0.3);
+
+BENCH_VIEW_CREATION_ONE(ecss_r, view_create)
+BENCH_VIEW_CREATION_ONE(ecss_r, view_create_iterate)
+BENCH_VIEW_CREATION_ONE(entt_r, view_create)
+BENCH_VIEW_CREATION_ONE(entt_r, view_create_iterate)
+BENCH_VIEW_CREATION_ONE(entt_r, group_create)
+BENCH_VIEW_CREATION_ONE(entt_r, group_create_iterate)
+BENCH_VIEW_CREATION_ONE(flecs_r, query_create)
+BENCH_VIEW_CREATION_ONE(flecs_r, query_create_iterate)
+BENCH_VIEW_CREATION_ONE(flecs_r, query_cached_create)
+BENCH_VIEW_CREATION_ONE(flecs_r, query_cached_create_iterate)
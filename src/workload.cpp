@@ -0,0 +1,493 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "backends.h"
+#include "components.h"
+#include "memory_tracking.h"
+#include "workload.h"
+
+namespace workload {
+namespace {
+    constexpr float kDt = 1.f / 60.f;
+
+    // Components a mix can name; the index is the bit in Archetype::components
+    using Catalog = std::tuple<Position, Velocity, Transform, RigidBody, Health, Sprite, AIState, Damage>;
+    constexpr size_t kCatalogSize = std::tuple_size_v<Catalog>;
+    constexpr std::array<std::string_view, kCatalogSize> kComponentNames = {
+        "Position", "Velocity", "Transform", "RigidBody", "Health", "Sprite", "AIState", "Damage"
+    };
+
+    constexpr std::string_view kDefaultMix =
+        "Transform:30,Transform+Sprite:30,Transform+RigidBody:20,Transform+RigidBody+Sprite+Health:10,Position+Velocity+AIState:10";
+
+    template <typename T, size_t I = 0>
+    constexpr uint32_t bit() {
+        if constexpr (std::is_same_v<T, std::tuple_element_t<I, Catalog>>) {
+            return 1u << I;
+        } else {
+            return bit<T, I + 1>();
+        }
+    }
+
+    template <typename... Ts>
+    constexpr uint32_t bits() { return (bit<Ts>() | ...); }
+
+    // fn.template operator()<T>() for every catalog component in mask
+    template <typename Fn>
+    void forEachComponent(uint32_t mask, Fn&& fn) {
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            ((mask & (1u << I) ? fn.template operator()<std::tuple_element_t<I, Catalog>>() : void()), ...);
+        }(std::make_index_sequence<kCatalogSize>{});
+    }
+
+    template <typename T>
+    T initial(uint64_t index) {
+        const int i = static_cast<int>(index);
+        const float f = static_cast<float>(i);
+        if constexpr (std::is_same_v<T, Position>) {
+            return Position{ f, 0.f, 0.f };
+        } else if constexpr (std::is_same_v<T, Velocity>) {
+            return Velocity{ 1.f, 0.5f, 0.f };
+        } else if constexpr (std::is_same_v<T, Transform>) {
+            return Transform{ f, f * 2.f, 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f };
+        } else if constexpr (std::is_same_v<T, RigidBody>) {
+            return RigidBody{ 1.f, 0.5f, 0.f, 0.f, -9.8f, 0.f, 1.f, 0.1f };
+        } else if constexpr (std::is_same_v<T, Health>) {
+            return Health{ 50.f + (float)(i % 50), 100.f, 1.f, false };
+        } else if constexpr (std::is_same_v<T, Sprite>) {
+            return Sprite{ (uint32_t)(i % 256), 0.f, 0.f, 1.f, 1.f, 0xFFFFFFFF, i % 8 };
+        } else if constexpr (std::is_same_v<T, AIState>) {
+            return AIState{ i % 4, 0.f, 10.f, 2.f, 0u };
+        } else {
+            return Damage{ 10.f, 2.f, 0.1f, 2.f };
+        }
+    }
+
+    // Deterministic archetype per spawn index, distributed by the mix weights
+    class MixSampler {
+    public:
+        explicit MixSampler(const std::vector<Archetype>& mix) {
+            double total = 0.0;
+            for (const auto& archetype : mix) {
+                total += archetype.weight;
+                mCumulative.push_back(total);
+                mMasks.push_back(archetype.components);
+            }
+            mTotal = total;
+        }
+
+        uint32_t pick(uint64_t index) const {
+            uint64_t h = index * 0x9E3779B97F4A7C15ull;
+            h ^= h >> 31;
+            h *= 0xBF58476D1CE4E5B9ull;
+            h ^= h >> 29;
+            const double u = static_cast<double>(h >> 11) * 0x1.0p-53 * mTotal;
+            const auto it = std::upper_bound(mCumulative.begin(), mCumulative.end(), u);
+            return mMasks[std::min<size_t>(it - mCumulative.begin(), mMasks.size() - 1)];
+        }
+
+        uint32_t used() const {
+            uint32_t mask = 0;
+            for (auto m : mMasks) {
+                mask |= m;
+            }
+            return mask;
+        }
+
+    private:
+        std::vector<double> mCumulative;
+        std::vector<uint32_t> mMasks;
+        double mTotal = 0.0;
+    };
+
+    // Population of one backend, oldest entities first
+    template <backend::Backend B>
+    class World {
+    public:
+        using Entity = typename B::Entity;
+
+        explicit World(const Config& config) : mSampler(config.mix) {}
+
+        B& ecs() { return mEcs; }
+        size_t size() const { return mAlive.size(); }
+        uint32_t usedComponents() const { return mSampler.used() | bit<Health>(); }
+
+        void spawn(size_t count) {
+            for (size_t i = 0; i < count; ++i, ++mSpawned) {
+                const uint32_t mask = mSampler.pick(mSpawned);
+                const Entity e = mEcs.create();
+                forEachComponent(mask, [&]<typename T>() { mEcs.template add<T>(e, initial<T>(mSpawned)); });
+                mAlive.push_back(e);
+                mMasks.push_back(mask);
+            }
+        }
+
+        // Destroys the `count` oldest entities and spawns as many new ones from the mix
+        void churn(size_t count) {
+            count = std::min(count, mAlive.size());
+            if (count == 0) {
+                return;
+            }
+            mVictims.assign(mAlive.begin(), mAlive.begin() + count);
+            mEcs.destroy(mVictims);
+            mAlive.erase(mAlive.begin(), mAlive.begin() + count);
+            mMasks.erase(mMasks.begin(), mMasks.begin() + count);
+            spawn(count);
+        }
+
+        // Flips Health on `count` entities spread over the population (offset moves every frame)
+        void migrate(size_t count) {
+            if (count == 0 || mAlive.empty()) {
+                return;
+            }
+            const size_t stride = std::max<size_t>(1, mAlive.size() / count);
+            size_t done = 0;
+            for (size_t i = mFrame++ % stride; i < mAlive.size() && done < count; i += stride, ++done) {
+                if (mMasks[i] & bit<Health>()) {
+                    mEcs.template remove<Health>(mAlive[i]);
+                } else {
+                    mEcs.template add<Health>(mAlive[i], initial<Health>(i));
+                }
+                mMasks[i] ^= bit<Health>();
+            }
+        }
+
+    private:
+        B mEcs;
+        MixSampler mSampler;
+        std::vector<Entity> mAlive;
+        std::vector<uint32_t> mMasks;
+        std::vector<Entity> mVictims;
+        uint64_t mSpawned = 0;
+        uint64_t mFrame = 0;
+    };
+
+    // The systems of a frame; views are only made for component sets the mix can produce
+    template <backend::Backend B>
+    class Systems {
+        template <typename... Ts>
+        using View = decltype(std::declval<B&>().template view<Ts...>());
+
+    public:
+        Systems(B& ecs, uint32_t used) {
+            auto make = [&]<typename... Ts>(std::optional<View<Ts...>>& view) {
+                if ((used & bits<Ts...>()) == bits<Ts...>()) {
+                    view.emplace(ecs.template view<Ts...>());
+                }
+            };
+            make.template operator()<Position, Velocity>(mMovement);
+            make.template operator()<Transform, RigidBody>(mPhysics);
+            make.template operator()<Health>(mHealth);
+            make.template operator()<Transform, Sprite>(mRender);
+            make.template operator()<AIState>(mAi);
+        }
+
+        float run() {
+            float accum = 0.f;
+            if (mMovement) {
+                mMovement->each([](Position& p, Velocity& v) {
+                    p.x += v.vx * kDt;
+                    p.y += v.vy * kDt;
+                    p.z += v.vz * kDt;
+                });
+            }
+            if (mPhysics) {
+                mPhysics->each([](Transform& t, RigidBody& rb) {
+                    rb.vx += rb.ax * kDt;
+                    rb.vy += rb.ay * kDt;
+                    rb.vz += rb.az * kDt;
+                    rb.vx *= (1.f - rb.drag * kDt);
+                    rb.vy *= (1.f - rb.drag * kDt);
+                    rb.vz *= (1.f - rb.drag * kDt);
+                    t.x += rb.vx * kDt;
+                    t.y += rb.vy * kDt;
+                    t.z += rb.vz * kDt;
+                });
+            }
+            if (mHealth) {
+                mHealth->each([](Health& h) {
+                    if (!h.isDead) {
+                        h.current = std::min(h.current + h.regen * kDt, h.max);
+                    }
+                });
+            }
+            if (mRender) {
+                mRender->each([&](Transform& t, Sprite& s) { accum += t.x * (float)s.layer; });
+            }
+            if (mAi) {
+                mAi->each([](AIState& ai) {
+                    ai.timer += kDt;
+                    if (ai.timer > 1.f) {
+                        ai.timer = 0.f;
+                        ai.state = (ai.state + 1) % 4;
+                    }
+                });
+            }
+            return accum;
+        }
+
+    private:
+        std::optional<View<Position, Velocity>> mMovement;
+        std::optional<View<Transform, RigidBody>> mPhysics;
+        std::optional<View<Health>> mHealth;
+        std::optional<View<Transform, Sprite>> mRender;
+        std::optional<View<AIState>> mAi;
+    };
+
+    size_t percentOf(size_t n, int64_t pct) {
+        return n * static_cast<size_t>(pct) / 100;
+    }
+
+    template <backend::Backend B>
+    void spawnScenario(benchmark::State& state, const Config& config) {
+        const size_t n = static_cast<size_t>(state.range(0));
+        std::optional<World<B>> world;
+        for (auto _ : state) {
+            state.PauseTiming();
+            world.reset();
+            world.emplace(config);
+            state.ResumeTiming();
+
+            world->spawn(n);
+            benchmark::ClobberMemory();
+        }
+        state.PauseTiming();
+        world.reset();
+        state.ResumeTiming();
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+    }
+
+    template <backend::Backend B>
+    void iterateScenario(benchmark::State& state, const Config& config) {
+        World<B> world(config);
+        world.spawn(static_cast<size_t>(state.range(0)));
+        Systems<B> systems(world.ecs(), world.usedComponents());
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(systems.run());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // Views are rebuilt every frame, after the structural changes
+    template <backend::Backend B>
+    void frameScenario(benchmark::State& state, const Config& config) {
+        const size_t n = static_cast<size_t>(state.range(0));
+        World<B> world(config);
+        world.spawn(n);
+        const size_t churned = percentOf(n, config.churnPct);
+        const size_t migrated = percentOf(n, config.migratePct);
+        for (auto _ : state) {
+            world.churn(churned);
+            world.migrate(migrated);
+            Systems<B> systems(world.ecs(), world.usedComponents());
+            benchmark::DoNotOptimize(systems.run());
+            benchmark::ClobberMemory();
+        }
+        state.counters["churned"] = static_cast<double>(churned);
+        state.counters["migrated"] = static_cast<double>(migrated);
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+    }
+
+    using Scenario = void (*)(benchmark::State&, const Config&);
+
+    template <backend::Backend B>
+    void registerBackend(const std::shared_ptr<const Config>& config) {
+        const std::pair<const char*, Scenario> scenarios[] = {
+            { "spawn", &spawnScenario<B> },
+            { "iterate", &iterateScenario<B> },
+            { "frame", &frameScenario<B> },
+        };
+        for (const auto& [scenario, run] : scenarios) {
+            const std::string name = "workload/" + config->name + "/" + B::name + "/" + scenario;
+            auto* bench = benchmark::RegisterBenchmark(name.c_str(), [config, run = run](benchmark::State& state) {
+                memtrack::track(state, [&](benchmark::State& s) { run(s, *config); });
+            });
+            bench->Unit(benchmark::TimeUnit::kMicrosecond)->MinTime(0.3);
+            for (auto n : config->sizes) {
+                bench->Arg(n);
+            }
+        }
+    }
+
+    bool fail(const std::string& message) {
+        std::fprintf(stderr, "workload: %s\n", message.c_str());
+        return false;
+    }
+
+    std::string_view trim(std::string_view s) {
+        const auto begin = s.find_first_not_of(" \t\r");
+        if (begin == std::string_view::npos) {
+            return {};
+        }
+        return s.substr(begin, s.find_last_not_of(" \t\r") - begin + 1);
+    }
+
+    // Calls fn(item) for every comma-separated item
+    template <typename Fn>
+    bool forEachItem(std::string_view list, Fn&& fn) {
+        while (!list.empty()) {
+            const auto comma = list.find(',');
+            if (!fn(trim(list.substr(0, comma)))) {
+                return false;
+            }
+            list = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1);
+        }
+        return true;
+    }
+
+    template <typename T>
+    bool parseNumber(std::string_view text, T& out) {
+        const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+        return ec == std::errc{} && end == text.data() + text.size();
+    }
+
+    bool parsePercent(std::string_view key, std::string_view value, int64_t& out) {
+        if (!parseNumber(value, out) || out < 0 || out > 100) {
+            return fail(std::string(key) + " must be a percentage (0-100), got '" + std::string(value) + "'");
+        }
+        return true;
+    }
+
+    bool parseSizes(std::string_view value, std::vector<int64_t>& sizes) {
+        sizes.clear();
+        const bool ok = forEachItem(value, [&](std::string_view item) {
+            int64_t n = 0;
+            if (!parseNumber(item, n) || n <= 0) {
+                return fail("bad size '" + std::string(item) + "'");
+            }
+            sizes.push_back(n);
+            return true;
+        });
+        return ok && (!sizes.empty() || fail("sizes is empty"));
+    }
+
+    // Component+Component:weight[,...]; a missing weight means 1
+    bool parseMix(std::string_view value, std::vector<Archetype>& mix) {
+        mix.clear();
+        const bool ok = forEachItem(value, [&](std::string_view item) {
+            Archetype archetype;
+            const auto colon = item.find(':');
+            if (colon != std::string_view::npos && (!parseNumber(trim(item.substr(colon + 1)), archetype.weight) || archetype.weight <= 0.0)) {
+                return fail("bad weight in '" + std::string(item) + "'");
+            }
+            std::string_view components = trim(item.substr(0, colon));
+            while (!components.empty()) {
+                const auto plus = components.find('+');
+                const auto component = trim(components.substr(0, plus));
+                const auto it = std::find(kComponentNames.begin(), kComponentNames.end(), component);
+                if (it == kComponentNames.end()) {
+                    return fail("unknown component '" + std::string(component) + "'");
+                }
+                archetype.components |= 1u << (it - kComponentNames.begin());
+                components = plus == std::string_view::npos ? std::string_view{} : components.substr(plus + 1);
+            }
+            if (archetype.components == 0) {
+                return fail("empty archetype in mix");
+            }
+            mix.push_back(archetype);
+            return true;
+        });
+        return ok && (!mix.empty() || fail("mix is empty"));
+    }
+
+    bool apply(Config& config, std::string_view key, std::string_view value) {
+        if (key == "name") {
+            config.name = std::string(value);
+            return !config.name.empty() || fail("name is empty");
+        }
+        if (key == "sizes") {
+            return parseSizes(value, config.sizes);
+        }
+        if (key == "mix") {
+            return parseMix(value, config.mix);
+        }
+        if (key == "churn_pct") {
+            return parsePercent(key, value, config.churnPct);
+        }
+        if (key == "migrate_pct") {
+            return parsePercent(key, value, config.migratePct);
+        }
+        return fail("unknown key '" + std::string(key) + "'");
+    }
+
+    bool readConfigFile(const std::string& path, Config& config) {
+        std::ifstream in(path);
+        if (!in) {
+            return fail("cannot open " + path);
+        }
+        std::string line;
+        while (std::getline(in, line)) {
+            std::string_view text = line;
+            text = trim(text.substr(0, text.find('#')));
+            if (text.empty()) {
+                continue;
+            }
+            const auto eq = text.find('=');
+            if (eq == std::string_view::npos) {
+                return fail(path + ": expected key = value, got '" + std::string(text) + "'");
+            }
+            if (!apply(config, trim(text.substr(0, eq)), trim(text.substr(eq + 1)))) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+bool registerFromCommandLine(int& argc, char** argv) {
+    constexpr std::string_view prefix = "--workload_";
+    std::vector<std::pair<std::string_view, std::string_view>> flags;
+    int kept = 1;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (!arg.starts_with(prefix)) {
+            argv[kept++] = argv[i];
+            continue;
+        }
+        const auto eq = arg.find('=');
+        if (eq == std::string_view::npos) {
+            return fail("expected " + std::string(arg) + "=<value>");
+        }
+        flags.emplace_back(arg.substr(prefix.size(), eq - prefix.size()), arg.substr(eq + 1));
+    }
+    argc = kept;
+    argv[argc] = nullptr;
+
+    auto config = std::make_shared<Config>();
+    parseMix(kDefaultMix, config->mix);
+    for (const auto& [key, value] : flags) {
+        if (key == "config" && !readConfigFile(std::string(value), *config)) {
+            return false;
+        }
+    }
+    for (const auto& [key, value] : flags) {
+        if (key != "config" && !apply(*config, key, value)) {
+            return false;
+        }
+    }
+
+    registerBackend<backend::Ecss<false>>(config);
+    // MSVC has issues with std::atomic::wait()/notify_all() used in ecss_ts (see registration.h)
+#ifndef _MSC_VER
+    registerBackend<backend::Ecss<true>>(config);
+#endif
+    registerBackend<backend::Entt>(config);
+    registerBackend<backend::Flecs>(config);
+    return true;
+}
+}
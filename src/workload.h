@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Configurable entity workloads, written once against backend::Backend (backends.h) and registered at
+// startup for every ECS as workload/<name>/<ecs>/<scenario>/<entities>:
+//  spawn   - build the whole population from the mix
+//  iterate - one pass of the systems over the population
+//  frame   - churn + component migration + systems, like a game frame
+//
+// Flags (removed from argv before google benchmark sees them), or the same keys as `key = value`
+// lines in --workload_config=<file> (flags win, '#' starts a comment):
+//  --workload_name=<name>             row name segment (default "default")
+//  --workload_sizes=<n>[,<n>...]      populations (default 10000,100000)
+//  --workload_mix=<A+B:w>[,...]       archetypes and their weights, e.g. Transform+RigidBody:60,Transform+Sprite:40
+//                                     (components: Position Velocity Transform RigidBody Health Sprite AIState Damage)
+//  --workload_churn_pct=<pct>         entities destroyed and respawned per frame (default 10)
+//  --workload_migrate_pct=<pct>       entities gaining or losing Health per frame (default 5)
+namespace workload {
+    struct Archetype {
+        uint32_t components = 0; // bit i = i-th component of the catalog
+        double weight = 1.0;
+    };
+
+    struct Config {
+        std::string name = "default";
+        std::vector<int64_t> sizes{ 10000, 100000 };
+        std::vector<Archetype> mix;
+        int64_t churnPct = 10;
+        int64_t migratePct = 5;
+    };
+
+    // Parses the workload flags out of argv and registers the rows. Returns false (after printing the
+    // reason to stderr) on a malformed flag or config file.
+    bool registerFromCommandLine(int& argc, char** argv);
+}
@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+"""Compare a google benchmark JSON run against a baseline run of the same suite.
+
+Rows are matched by run_name (<ecs>.....................<func>/<arg>, realistic/<ecs>/<func>/<arg>).
+For every row both runs hold:
+  - with several repetitions on both sides: two-sided Mann-Whitney U test on cpu_time (the test
+    google benchmark's compare.py runs), a change counts only if p < --alpha
+  - with a single sample on either side: the plain ratio, reported as "no U test"
+A row regresses when its median cpu_time grew by more than --threshold and that change is significant.
+Regressions of rows matching a --hot pattern fail the run (exit 1) unless --warn-only is given; all
+others are reported as warnings. On GitHub Actions the findings become ::error/::warning annotations
+and --summary appends a markdown table (e.g. $GITHUB_STEP_SUMMARY).
+
+    compare_baseline.py baseline.json current.json --hot iter_grouped_multi --hot entity_churn
+"""
+
+import argparse
+import json
+import math
+import os
+import re
+import statistics
+import sys
+
+TIME_UNITS_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+MAX_ANNOTATIONS = 10  # GitHub shows at most 10 annotations of a kind per step
+
+
+def load_samples(path):
+    """run_name -> list of cpu_time samples in ns (iteration rows only, aggregates are recomputed)."""
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f)
+    samples = {}
+    for bench in data.get("benchmarks", []):
+        if bench.get("run_type", "iteration") != "iteration" or bench.get("error_occurred"):
+            continue
+        name = bench.get("run_name", bench["name"])
+        scale = TIME_UNITS_NS.get(bench.get("time_unit", "ns"), 1.0)
+        samples.setdefault(name, []).append(float(bench["cpu_time"]) * scale)
+    return samples
+
+
+def mann_whitney_p(xs, ys):
+    """Two-sided p-value of the Mann-Whitney U test, normal approximation with tie correction."""
+    n1, n2 = len(xs), len(ys)
+    ranked = sorted([(v, 0) for v in xs] + [(v, 1) for v in ys])
+    ranks = [0.0] * len(ranked)
+    tie_term = 0.0
+    i = 0
+    while i < len(ranked):
+        j = i
+        while j + 1 < len(ranked) and ranked[j + 1][0] == ranked[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1.0
+        ties = j - i + 1
+        tie_term += ties ** 3 - ties
+        i = j + 1
+
+    r1 = sum(r for r, (_, group) in zip(ranks, ranked) if group == 0)
+    u1 = r1 - n1 * (n1 + 1) / 2.0
+    n = n1 + n2
+    mean = n1 * n2 / 2.0
+    variance = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1)))
+    if variance <= 0.0:
+        return 1.0
+    z = (abs(u1 - mean) - 0.5) / math.sqrt(variance)
+    return min(1.0, math.erfc(max(z, 0.0) / math.sqrt(2.0)))
+
+
+def describe(samples):
+    median = statistics.median(samples)
+    stdev = statistics.stdev(samples) if len(samples) > 1 else 0.0
+    mean = statistics.fmean(samples)
+    return median, mean, stdev / mean if mean else 0.0
+
+
+def format_ns(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return f"{ns / scale:.3g} {unit}"
+    return f"{ns:.3g} ns"
+
+
+def compare(baseline, current, args, hot):
+    rows = []
+    for name in sorted(set(baseline) & set(current)):
+        base, cur = baseline[name], current[name]
+        base_median, _, base_cv = describe(base)
+        cur_median, _, cur_cv = describe(cur)
+        change = cur_median / base_median - 1.0 if base_median > 0 else 0.0
+
+        tested = len(base) >= args.min_repetitions and len(cur) >= args.min_repetitions
+        p_value = mann_whitney_p(base, cur) if tested else None
+        significant = p_value < args.alpha if tested else True
+
+        if change > args.threshold and significant:
+            verdict = "regression"
+        elif change < -args.threshold and significant:
+            verdict = "improvement"
+        else:
+            verdict = "same"
+        rows.append({
+            "name": name,
+            "hot": any(p.search(name) for p in hot),
+            "base": base_median, "cur": cur_median, "change": change,
+            "base_cv": base_cv, "cur_cv": cur_cv, "reps": (len(base), len(cur)),
+            "p": p_value, "verdict": verdict,
+        })
+    return rows
+
+
+def row_message(row):
+    p = "no U test" if row["p"] is None else f"p={row['p']:.4f}"
+    return (f"{row['name']}: {format_ns(row['base'])} -> {format_ns(row['cur'])} ({row['change']:+.1%}, {p}, "
+            f"cv {row['base_cv']:.1%}/{row['cur_cv']:.1%}, reps {row['reps'][0]}/{row['reps'][1]})")
+
+
+def write_summary(path, title, rows, missing):
+    changed = [r for r in rows if r["verdict"] != "same"]
+    with open(path, "a", encoding="utf-8") as f:
+        f.write(f"### {title}\n\n")
+        f.write(f"{len(rows)} rows compared, {sum(r['verdict'] == 'regression' for r in rows)} regressions, "
+                f"{sum(r['verdict'] == 'improvement' for r in rows)} improvements, {missing} rows without a baseline.\n\n")
+        if not changed:
+            return
+        f.write("| benchmark | baseline | current | change | p | cv base / current | reps |\n")
+        f.write("|---|---:|---:|---:|---:|---:|---:|\n")
+        for r in sorted(changed, key=lambda r: -r["change"]):
+            mark = " :fire:" if r["verdict"] == "regression" and r["hot"] else ""
+            p = "-" if r["p"] is None else f"{r['p']:.4f}"
+            f.write(f"| `{r['name']}`{mark} | {format_ns(r['base'])} | {format_ns(r['cur'])} | {r['change']:+.1%} | {p} "
+                    f"| {r['base_cv']:.1%} / {r['cur_cv']:.1%} | {r['reps'][0]} / {r['reps'][1]} |\n")
+        f.write("\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("baseline", help="baseline google benchmark JSON (missing file: nothing to compare)")
+    parser.add_argument("current", help="google benchmark JSON of this run")
+    parser.add_argument("--threshold", type=float, default=0.10, help="relative median cpu_time change that counts (default 0.10)")
+    parser.add_argument("--alpha", type=float, default=0.05, help="U test significance level (default 0.05)")
+    parser.add_argument("--min-repetitions", type=int, default=5, help="samples per side needed for the U test (default 5)")
+    parser.add_argument("--hot", action="append", default=[], metavar="REGEX", help="rows whose regressions fail the run")
+    parser.add_argument("--warn-only", action="store_true", help="never fail, report hot regressions as warnings")
+    parser.add_argument("--summary", help="append a markdown report to this file")
+    parser.add_argument("--title", default="Benchmark comparison", help="heading of the markdown report")
+    args = parser.parse_args()
+
+    if not os.path.exists(args.baseline):
+        print(f"no baseline at {args.baseline}, skipping comparison")
+        return 0
+
+    baseline = load_samples(args.baseline)
+    current = load_samples(args.current)
+    hot = [re.compile(p) for p in args.hot]
+    rows = compare(baseline, current, args, hot)
+    missing = len(set(current) - set(baseline))
+
+    annotations = {"error": 0, "warning": 0}
+    failed = False
+    for row in sorted(rows, key=lambda r: -r["change"]):
+        if row["verdict"] == "regression":
+            level = "error" if row["hot"] and not args.warn_only else "warning"
+            failed |= level == "error"
+            print(f"REGRESSION {row_message(row)}")
+            if annotations[level] < MAX_ANNOTATIONS:
+                annotations[level] += 1
+                print(f"::{level} title=Benchmark regression::{row_message(row)}")
+        elif row["verdict"] == "improvement":
+            print(f"improvement {row_message(row)}")
+
+    print(f"{len(rows)} rows compared, {missing} without a baseline")
+    if args.summary:
+        write_summary(args.summary, args.title, rows, missing)
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())